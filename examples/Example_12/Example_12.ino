@@ -0,0 +1,384 @@
+// Example_12 - simulation regression suite
+//				  - fast-forward virtual time with SchedSim to check long running schedules
+
+/*
+	SchedSim jumps a virtual clock straight to the earliest 'next' of all tasks and then runs the normal
+	dispatcher, so days of schedule (including the millis() rollover at 49.7 days) complete in a moment.
+
+	This sketch checks rollover, ONESHOT, iterations and NEVER behavior, and the dispatch latency of tasks that
+	are due at the same time, and prints PASS or FAIL for each check.  Set SCHED_ROTATE in SchedConfig.h to check
+	that the latency is also shared fairly, or SCHED_GROUPS to check SchedGroup.
+	It runs on a board or in a host build (32 or 64 bit) that provides Arduino.h; times are kept in uint32_t so
+	they roll over the way millis() does on the board.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+	2026-10-19 added retirement and latency distribution tests
+	2026-10-19 added group suspend/resume test (SCHED_GROUPS)
+	2026-10-19 32 bit time arithmetic, so a 64 bit host build checks the rollover too
+	2026-10-19 added snapshot round trip test
+	2026-10-19 added self destructing task test (SCHED_ROTATE)
+	2026-10-19 added SchedPool null function test
+	2026-10-19 added setNext() on a member of a suspended group
+*/
+
+const char CAPTION[] = "Example 12 Simulation regression suite";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTaskT.h>
+#include <SchedSim.h>												// virtual clock driver
+#include <SchedSnapshot.h>
+#include <SchedPool.h>
+#if SCHED_GROUPS
+#include <SchedGroup.h>
+#endif
+
+const unsigned long DAY = 86400000UL;							// one day in ms
+
+void record(int);														// forward declaration required by the constructors
+void testRollover();													// forward declarations so the sketch also builds on a host
+void testFiftyDays();
+void testNeverCollision();
+void testOneShot();
+void testIterations();
+void testNever();
+void testRetire();
+void testLatency();
+void testSnapshot();
+void testPool();
+void pooled(int);
+void testSelfDelete();
+void selfDestruct(int);
+void testGroup();
+
+const int TASKS = 3;
+SchedTaskT<int> Task0 (NEVER, ONESHOT, record, 0);			// tasks under test, configured by each test
+SchedTaskT<int> Task1 (NEVER, ONESHOT, record, 1);
+SchedTaskT<int> Task2 (NEVER, ONESHOT, record, 2);
+SchedTaskT<int>* tasks[TASKS] = {&Task0, &Task1, &Task2};
+SchedPool<2> Pool;														// one shot timers for testPool()
+SchedTaskT<int>* Doomed = nullptr;								// created with new, deletes itself when dispatched
+
+unsigned long count[TASKS];										// dispatches per task
+uint32_t last[TASKS];												// time of the last dispatch
+unsigned long minGap[TASKS];										// smallest and largest interval between dispatches
+unsigned long maxGap[TASKS];
+unsigned long maxLate[TASKS];										// worst and total lateness (dispatch time - scheduled time)
+unsigned long totalLate[TASKS];
+unsigned long cost = 0;												// simulated execution time of record()
+
+int passed = 0;
+int failed = 0;
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	testRollover();
+	testFiftyDays();
+	testNeverCollision();
+	testOneShot();
+	testIterations();
+	testNever();
+	testRetire();
+	testLatency();
+	testSnapshot();
+	testPool();
+#if SCHED_ROTATE
+	testSelfDelete();
+#endif
+#if SCHED_GROUPS
+	testGroup();
+#endif
+
+	SchedSim::end();													// back to millis()
+	Serial << "\n" << passed << " passed, " << failed << " failed\n";
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+}
+
+/********************* Functions ************************************/
+
+// dispatched function; keeps statistics for task i
+void record(int i) {
+	uint32_t now = SchedBase::getTime();						// virtual time during simulation
+	if (count[i]) {
+		uint32_t gap = now - last[i];
+		if (gap < minGap[i]) minGap[i] = gap;
+		if (gap > maxGap[i]) maxGap[i] = gap;
+	}
+	last[i] = now;
+	count[i]++;
+	if (tasks[i]->getPeriod() != ONESHOT) {					// periodic tasks: next has already moved on one period
+		uint32_t late = now - (tasks[i]->getNext() - tasks[i]->getPeriod());
+		if (late > maxLate[i]) maxLate[i] = late;
+		totalLate[i] += late;
+	}
+	SchedSim::consume(cost);										// pretend this took a while
+}
+
+// put every task back to a dormant state and clear the statistics
+void reset(unsigned long start) {
+	SchedSim::begin(start);
+	for (int i=0; i<TASKS; i++) {
+		tasks[i]->setNext(NEVER);
+		tasks[i]->setPeriod(ONESHOT);
+		tasks[i]->setIterations(-1);
+		count[i] = 0;
+		minGap[i] = 0xFFFFFFFFUL;
+		maxGap[i] = 0;
+		maxLate[i] = 0;
+		totalLate[i] = 0;
+	}
+	cost = 0;
+}
+
+void check(const char* name, bool ok) {
+	Serial << "\n" << (ok ? "PASS " : "FAIL ") << name;
+	if (ok) passed++;
+	else failed++;
+}
+
+// a periodic task keeps its period across the millis() rollover
+void testRollover() {
+	reset(0xFFFFFFFFUL - 10500);									// 10.5 sec before rollover
+	Task0.setPeriod(1000);
+	Task0.setNext(NOW);
+	SchedSim::runFor(20000);
+	check("rollover count", count[0] == 21);
+	check("rollover period", minGap[0] == 1000 && maxGap[0] == 1000);
+}
+
+// 50 days of schedule, past the 49.7 day rollover
+void testFiftyDays() {
+	reset(0);
+	Task0.setPeriod(60000UL);										// every minute
+	Task0.setNext(NOW);
+	Task1.setPeriod(3600000UL);									// every hour
+	Task1.setNext(1800000UL);										// starting on the half hour
+	for (int day=0; day<50; day++) {
+		SchedSim::runFor(DAY);
+	}
+	check("50 days minutes", count[0] == 50UL * 1440 + 1);
+	check("50 days minute period", minGap[0] == 60000UL && maxGap[0] == 60000UL);
+	check("50 days hours", count[1] == 50UL * 24);
+	check("50 days hour period", minGap[1] == 3600000UL && maxGap[1] == 3600000UL);
+}
+
+// a periodic 'next' landing on 0xFFFFFFFF must not be mistaken for NEVER
+void testNeverCollision() {
+	reset(0xFFFFFFFFUL - 20);
+	Task0.setPeriod(5);
+	Task0.setNext(NOW);												// 'next' steps onto 0xFFFFFFFF after 4 dispatches
+	SchedSim::runFor(100);
+	check("NEVER collision still running", Task0.getNext() != NEVER);
+	check("NEVER collision count", count[0] == 20);			// one dispatch 1 ms late
+	check("NEVER collision period", minGap[0] == 5 && maxGap[0] == 6);
+}
+
+// ONESHOT dispatches exactly once
+void testOneShot() {
+	reset(0);
+	Task0.setNext(500);
+	SchedSim::runFor(10000);
+	check("ONESHOT count", count[0] == 1 && last[0] == 500);
+	check("ONESHOT next", Task0.getNext() == NEVER);
+}
+
+// iterations limit the number of dispatches, then the task goes dormant
+void testIterations() {
+	reset(0);
+	Task0.setPeriod(100);
+	Task0.setIterations(5);
+	Task0.setNext(NOW);
+	Task1.setPeriod(100);											// unlimited, runs alongside
+	Task1.setNext(NOW);
+	SchedSim::runFor(1000);
+	check("iterations count", count[0] == 5);
+	check("iterations dormant", Task0.getNext() == NEVER && Task0.getIterations() == -1);
+	check("iterations neighbor", count[1] == 11);
+}
+
+// NEVER takes precedence over everything else
+void testNever() {
+	reset(0);
+	Task0.setPeriod(100);
+	Task0.setIterations(5);											// NEVER overrides remaining iterations
+	SchedSim::runFor(DAY);
+	check("NEVER not dispatched", count[0] == 0);
+
+	Task1.setPeriod(100);
+	Task1.setNext(NOW);
+	SchedSim::runFor(1000);
+	Task1.setNext(NEVER);											// kill it part way
+	SchedSim::runFor(DAY);
+	check("NEVER stops task", count[1] == 11);
+}
+
+// a task running out of iterations must not end the dispatcher pass early
+void testRetire() {
+	reset(0);
+	Task2.setPeriod(100);											// Task2 is first in the list
+	Task2.setIterations(1);
+	Task2.setNext(NOW);
+	Task0.setPeriod(100);											// Task0 is last
+	Task0.setNext(NOW);
+	SchedSim::runFor(150);											// at 100 Task2 retires and Task0 is due in the same pass
+	check("retire same pass", count[0] == 2 && SchedSim::getPasses() == 2);
+}
+
+// tasks due together: latency is bounded and (with SCHED_ROTATE) shared fairly
+void testLatency() {
+	const int ROUNDS = 300;
+	reset(0);
+	cost = 10;															// each dispatch takes 10 ms of virtual time
+	for (int i=0; i<TASKS; i++) {
+		tasks[i]->setPeriod(100);									// all due at the same moment
+		tasks[i]->setNext(NOW);
+	}
+	SchedSim::runFor(ROUNDS * 100UL - 1);
+
+	bool bounded = true;
+	unsigned long minMean = 0xFFFFFFFFUL;
+	unsigned long maxMean = 0;
+	Serial << "\n\ntask  dispatches  max late  mean late (ms)";
+	for (int i=0; i<TASKS; i++) {
+		unsigned long mean = totalLate[i] / count[i];
+		Serial << "\n" << i << "     " << count[i] << "         " << maxLate[i] << "        " << mean;
+		if (count[i] != ROUNDS || maxLate[i] > (TASKS - 1) * cost) bounded = false;
+		if (mean < minMean) minMean = mean;
+		if (mean > maxMean) maxMean = mean;
+	}
+	Serial << "\n";
+	check("latency bounded", bounded);
+#if SCHED_ROTATE
+	check("latency shared", maxMean - minMean <= cost);
+#endif
+}
+
+// a snapshot puts the tasks back as they were; one that was overdue at the save is due at once
+void testSnapshot() {
+	reset(0xFFFFFFFFUL - 50);										// across the rollover as well
+	Task0.setPeriod(100);
+	Task0.setNext(NOW);
+	Task1.setPeriod(100);
+	Task1.setNext(70);
+	Task1.setIterations(3);
+	SchedSim::consume(30);											// no dispatch for 30 ms: Task0 is overdue
+	uint8_t buf[128];												// the Pool slots are saved too
+	size_t n = SchedSnapshot::save(buf, sizeof(buf));
+	Task0.setNext(500);												// as the constructors might after a reset
+	Task1.setNext(NEVER);
+	Task1.setIterations(-1);
+	int restored = SchedSnapshot::restore(buf, n);
+	uint32_t now = SchedBase::getTime();
+	check("snapshot restored", n > 0 && restored == Task0.getTaskCount());
+	check("snapshot overdue due now", Task0.getNext() == now);
+	check("snapshot phase", (uint32_t)(Task1.getNext() - now) == 40 && Task1.getIterations() == 3);
+#if !SCHED_COMPACT
+	if (sizeof(int) > 2) {											// only where int holds more than 16 bits
+		Task2.setIterations(40000);
+		check("snapshot refuses iterations over 32767", SchedSnapshot::save(buf, sizeof(buf)) == 0);
+	}
+#endif
+}
+
+// a pool refuses a timer without a function rather than lose the slot to it
+void pooled(int i) {
+	count[i]++;
+}
+
+void testPool() {
+	reset(0);
+	int free = Pool.getFree();
+	SchedHandle h0 = Pool.schedule(nullptr, 10);
+	SchedHandle h1 = Pool.schedule(nullptr, 10, 1);
+	check("pool null function", h0 == 0 && h1 == 0 && Pool.getFree() == free);
+	SchedHandle h = Pool.schedule(pooled, 10, 0);
+	SchedSim::runFor(20);
+	check("pool timer runs", h != 0 && count[0] == 1 && !Pool.isPending(h) && Pool.getFree() == free);
+}
+
+#if SCHED_ROTATE
+// a task may destroy itself when dispatched, even when it is the first task of the pass
+void selfDestruct(int) {
+	delete Doomed;
+	Doomed = nullptr;
+}
+
+void testSelfDelete() {
+	reset(0);
+	Task0.setPeriod(10);
+	Task0.setNext(NOW);
+	Task1.setPeriod(10);
+	Task1.setNext(NOW);
+	int tasks = Task0.getTaskCount();
+	bool gone = true;
+	for (int k=0; k<2*TASKS; k++) {								// the passes start at a different task each time
+		Doomed = new SchedTaskT<int>(NOW, ONESHOT, selfDestruct, k);
+		SchedSim::runFor(10);											// never returns if a pass loses its way
+		if (Doomed || Task0.getTaskCount() != tasks) gone = false;
+	}
+	check("self delete", gone);
+	check("self delete neighbors", count[0] == 2 * TASKS + 1 && count[1] == 2 * TASKS + 1);
+}
+#endif
+
+#if SCHED_GROUPS
+// a suspended group is not dispatched and its members keep their phase across the suspension and a shift
+void testGroup() {
+	reset(0xFFFFFFFFUL - 2005);										// across the rollover as well
+	SchedGroup group;
+	Task0.setPeriod(100);
+	Task0.setNext(NOW);
+	Task1.setPeriod(100);
+	Task1.setNext(30);
+	Task2.setPeriod(100);
+	Task2.setNext(NOW);
+	group.add(Task0);
+	group.add(Task1);
+	SchedSim::runFor(999);
+	group.suspend();
+	SchedSim::runFor(450);
+	bool idle = count[0] == 10 && count[1] == 10 && count[2] == 15;
+	group.resume();
+	SchedSim::runFor(1000);
+	group.shift(10);
+	SchedSim::runFor(1000);
+	check("group suspended", idle);
+	check("group resumed", count[0] == 30 && count[1] == 30 && count[2] == 35);
+	check("group phase", last[1] - last[0] == 30 && maxGap[0] == 550 && maxGap[1] == 550);
+
+	reset(0);																// leaving a suspended group does not bring back the missed dispatches
+	SchedGroup paused;
+	Task0.setPeriod(10);
+	Task0.setNext(NOW);
+	paused.add(Task0);
+	SchedSim::runFor(95);
+	paused.suspend();
+	SchedSim::runFor(1000);
+	paused.remove(Task0);
+	SchedSim::runFor(100);
+	check("group remove while suspended", count[0] == 20 && maxGap[0] == 1010 && minGap[0] == 10);
+
+	reset(0);																// setNext() while suspended: due that long after the resume
+	SchedGroup held;
+	held.add(Task0);
+	held.suspend();
+	SchedSim::runFor(100);
+	Task0.setNext(50);
+	bool asSet = Task0.getNext() == SchedBase::getTime() + 50;
+	SchedSim::runFor(400);
+	held.resume();
+	SchedSim::runFor(1000);
+	check("group setNext while suspended", asSet && count[0] == 1 && last[0] == 550);
+}
+#endif
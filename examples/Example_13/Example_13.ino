@@ -0,0 +1,103 @@
+// Example_13 - report the RAM used by each type of task
+
+/*
+	Prints sizeof() for each task type with the options currently set in SchedConfig.h, and the size of a
+	SchedBase and a SchedTask in both layouts, full and SCHED_COMPACT, so one run shows what SCHED_COMPACT saves
+	on this board.  The other layout is worked out from a struct with the same members; the line for the layout
+	in use checks that struct against the real class.
+
+	With SCHED_COMPACT set the period and iterations are stored in 16 bits and the task ID is not stored at all,
+	see SchedConfig.h for the limits that implies.  On AVR a SchedTask goes from 18 to 14 bytes.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+	2026-10-19 both layouts reported in one run
+*/
+
+const char CAPTION[] = "Example 13 task sizes";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedTaskT.h>
+
+struct FullBase {														// the members of SchedBase without SCHED_COMPACT
+	virtual ~FullBase() {}
+	FullBase* taskLink;
+	uint32_t next;
+	unsigned long period;
+	int iterations;
+	int taskID;
+#if SCHED_NAMES
+	const char* name;
+#endif
+#if SCHED_GROUPS
+	void* group;
+#endif
+};
+
+struct CompactBase {													// the members of SchedBase with SCHED_COMPACT
+	virtual ~CompactBase() {}
+	CompactBase* taskLink;
+	uint32_t next;
+	uint16_t period;
+	int16_t iterations;
+#if SCHED_NAMES
+	const char* name;
+#endif
+#if SCHED_GROUPS
+	void* group;
+#endif
+};
+
+struct FullTask : FullBase {void (*func)();};					// and SchedTask, which adds the function
+struct CompactTask : CompactBase {void (*func)();};
+
+void report(const char*, size_t);									// forward declarations
+void layout(const char*, size_t, size_t, bool);
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	Serial << "\nSCHED_COMPACT " << SCHED_COMPACT;
+	Serial << "\n\ntype                    bytes  tasks/KB";
+	report("SchedBase", sizeof(SchedBase));
+	report("SchedTask", sizeof(SchedTask));
+	report("SchedTaskT<int>", sizeof(SchedTaskT<int>));
+	report("SchedTaskT<long>", sizeof(SchedTaskT<long>));
+	report("SchedTaskT<SchedBase*>", sizeof(SchedTaskT<SchedBase*>));
+
+	Serial << "\n\nlayout     SchedBase  SchedTask";
+	layout("full", sizeof(FullBase), sizeof(FullTask), !SCHED_COMPACT);
+	layout("compact", sizeof(CompactBase), sizeof(CompactTask), SCHED_COMPACT);
+	Serial << "\n";
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+}
+
+/********************* Functions ************************************/
+
+void report(const char* name, size_t size) {
+	Serial << "\n" << name;
+	for (int i=strlen(name); i<24; i++) Serial << ' ';		// line up the columns
+	Serial << size << "      " << 1024 / size;
+}
+
+// one layout; the one in use is checked against the real classes
+void layout(const char* name, size_t base, size_t task, bool inUse) {
+	Serial << "\n" << name;
+	for (int i=strlen(name); i<11; i++) Serial << ' ';
+	Serial << base << "         " << task;
+	if (inUse) {
+		bool same = base == sizeof(SchedBase) && task == sizeof(SchedTask);
+		Serial << "         in use, " << (same ? "matches the classes" : "differs from the classes");
+	}
+}
@@ -0,0 +1,135 @@
+// Example_14 - dispatch hooks
+//				  - run your own code around every dispatch without changing the library
+
+/*
+	SchedBase::dispatcher<Hooks>() calls three static functions of the class Hooks:
+
+		Hooks::preDispatch(SchedBase* task)		just before the task's function is called
+		Hooks::postDispatch(SchedBase* task)	just after it returns
+		Hooks::idle()									after a pass of the task list that dispatched nothing
+
+	The hooks are resolved at compile time so empty ones cost nothing.  SchedBase::dispatcher() is the same
+	dispatcher using SchedNoHooks.
+
+	This sketch raises SCOPE_PIN while any task runs (watch it with a scope or logic analyzer) and first times
+	the dispatcher with no hooks, empty hooks and the scope hooks, and checks (PASS or FAIL) that the empty hooks
+	cost the same as none, within TOLERANCE percent.  The blinking tasks are parked at NEVER while timing, every
+	timed pass starts with the same tasks due, and the three dispatchers take turns so drift hits each alike.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+	2026-10-19 timing runs over the same task states, PASS/FAIL against a tolerance
+*/
+
+const char CAPTION[] = "Example 14 dispatch hooks";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+
+const int SCOPE_PIN = LED_PIN_1;									// high while a task is running
+const int PASSES = 1000;											// dispatcher passes timed for each dispatcher
+const int ROUNDS = 10;												// the dispatchers take turns, PASSES / ROUNDS passes at a time
+const int TOLERANCE = 10;											// percent the empty hooks may differ from none (timer resolution)
+const int TASKS = 8;
+
+struct ScopeHooks {													// hooks to watch dispatches on a scope
+	static void preDispatch(SchedBase*) {digitalWrite(SCOPE_PIN, HIGH);}
+	static void postDispatch(SchedBase*) {digitalWrite(SCOPE_PIN, LOW);}
+	static void idle() {}
+};
+
+struct EmptyHooks {													// should cost the same as no hooks at all
+	static void preDispatch(SchedBase*) {}
+	static void postDispatch(SchedBase*) {}
+	static void idle() {}
+};
+
+void turnOnLED();														// forward declarations
+void turnOffLED();
+void nothing();
+void rearm();
+unsigned long timeIt(void (*)(), int passes);
+
+SchedTask OnTask (NOW, PERIOD, turnOnLED);					// blink while the loop dispatches with ScopeHooks
+SchedTask OffTask (DURATION, PERIOD, turnOffLED);
+
+SchedTask Bench[TASKS];												// tasks used only for timing
+
+void noHooks() {SchedBase::dispatcher();}						// the three dispatchers to time
+void emptyHooks() {SchedBase::dispatcher<EmptyHooks>();}
+void scopeHooks() {SchedBase::dispatcher<ScopeHooks>();}
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	pinMode(LED_PIN, OUTPUT);										// initialize the hardware pins
+	pinMode(SCOPE_PIN, OUTPUT);
+
+	for (int i=0; i<TASKS; i++) Bench[i].setFunc(nothing);
+
+	OnTask.setNext(NEVER);											// only the bench tasks are due while timing
+	OffTask.setNext(NEVER);
+	unsigned long none = 0, empty = 0, scope = 0;
+	for (int round=0; round<ROUNDS; round++) {
+		none += timeIt(noHooks, PASSES / ROUNDS);
+		empty += timeIt(emptyHooks, PASSES / ROUNDS);
+		scope += timeIt(scopeHooks, PASSES / ROUNDS);
+	}
+	Serial << "\nus per " << PASSES << " passes, " << TASKS << " tasks due each pass";
+	Serial << "\n  no hooks    " << none;
+	Serial << "\n  empty hooks " << empty;
+	Serial << "\n  scope hooks " << scope;
+	unsigned long slack = none / 100 * TOLERANCE;
+	bool same = empty <= none + slack && empty + slack >= none;
+	Serial << "\n" << (same ? "PASS" : "FAIL") << " empty hooks cost the same as none (" << TOLERANCE << "%)";
+
+	for (int i=0; i<TASKS; i++) {									// done timing; the dispatcher skips these now
+		Bench[i].setFunc(NULL);
+		Bench[i].setNext(NEVER);
+	}
+	OnTask.setNext(NOW);												// start blinking
+	OffTask.setNext(DURATION);
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher<ScopeHooks>();						// dispatch with the scope hooks
+}
+
+/********************* Functions ************************************/
+
+// time 'passes' calls of a dispatcher, each starting with every bench task due
+unsigned long timeIt(void (*dispatch)(), int passes) {
+	unsigned long total = 0;
+	for (int pass=0; pass<passes; pass++) {
+		rearm();															// not timed
+		unsigned long start = micros();
+		dispatch();
+		total += micros() - start;
+	}
+	return total;
+}
+
+// make every bench task due
+void rearm() {
+	for (int i=0; i<TASKS; i++) Bench[i].setNext(NOW);
+}
+
+void nothing() {}
+
+// turn the LED on
+void turnOnLED() {
+	digitalWrite(LED_PIN, ON);										// turn on the LED
+}
+
+// turn the LED off
+void turnOffLED() {
+	digitalWrite(LED_PIN, OFF);									// turn off the LED
+}
@@ -0,0 +1,72 @@
+// Example_15 - CPU utilization and schedulability report
+
+/*
+	SchedProfiler measures the worst case execution time (WCET) of every task when used as the dispatch hooks:
+
+		SchedBase::dispatcher<SchedProfiler>();
+
+	SchedReport combines those times with the task periods to show the utilization of each task, the total,
+	and whether the task set passes the rate monotonic and earliest deadline first tests for the cooperative
+	dispatcher.  Tasks that take longer than the shortest period are flagged.
+
+	Here three tasks simulate work with delayMicroseconds().  A fourth task is not running yet; its cost is
+	declared with SchedProfiler::setWcet() so the report shows whether it could be added.  A report is
+	printed every 5 seconds.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+*/
+
+const char CAPTION[] = "Example 15 utilization report";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedReport.h>												// also includes SchedProfiler.h
+
+void fastTask();														// forward declarations
+void mediumTask();
+void slowTask();
+void newTask();
+void report();
+
+SchedTask Fast (NOW, 10, fastTask);								// every 10 ms, about 1 ms of work
+SchedTask Medium (NOW, 50, mediumTask);						// every 50 ms, about 5 ms of work
+SchedTask Slow (NOW, 1000, slowTask);							// every second, about 3 ms of work
+SchedTask Candidate (NEVER, 20, newTask);						// not started; declared to take 4 ms
+SchedTask Report (5000, 5000, report);							// print the report every 5 seconds
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	SchedProfiler::setWcet(Candidate.getTaskID(), 4000);	// what the new task is expected to cost
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher<SchedProfiler>();					// dispatch and measure each task
+}
+
+/********************* Functions ************************************/
+
+void fastTask() {delayMicroseconds(1000);}
+void mediumTask() {delayMicroseconds(5000);}
+void slowTask() {delayMicroseconds(3000);}
+void newTask() {delayMicroseconds(4000);}
+
+// print the report, first as things are, then as if Candidate were running too
+void report() {
+	Serial << "\n--- current tasks ---";
+	SchedReport::print(Serial);
+
+	Candidate.setNext(NOW);											// make it count in the report
+	Serial << "\n--- with Candidate every " << Candidate.getPeriod() << " ms ---";
+	SchedReport::print(Serial);
+	Candidate.setNext(NEVER);										// but don't actually start it
+}
@@ -0,0 +1,83 @@
+// Example_16 - fire-and-forget timers from a pool
+
+/*
+	A SchedPool holds a fixed number of one shot timers.  schedule() takes a free one and returns a handle;
+	the timer frees itself once its function has run.  This avoids declaring a named SchedTask for every
+	short lived timer and avoids creating tasks with new.
+
+		SchedHandle h = Timers.schedule(turnOffLED, 200);			// turn the LED off in 200 ms
+		Timers.cancel(h);													// changed our mind
+
+	Every second the LED is turned on and a pooled timer turns it off again.  Every 5 seconds a burst of
+	timers with a parameter prints a countdown, and one of them is cancelled.  Cancelling with a handle whose
+	timer has already run does nothing, even when the slot has been reused.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+*/
+
+const char CAPTION[] = "Example 16 pooled timers";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedPool.h>
+
+void blink();															// forward declarations
+void countdown();
+void turnOffLED();
+void say(int);
+
+SchedPool<8> Timers;													// up to 8 timers pending at once, parameter type int
+
+SchedTask BlinkTask (NOW, 1000, blink);						// every second
+SchedTask CountdownTask (2000, 5000, countdown);			// every 5 seconds
+
+SchedHandle offTimer;												// handle of the latest turn off timer
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	pinMode(LED_PIN, OUTPUT);										// initialize the hardware pin for LED
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher();										// pooled timers are dispatched like any other task
+}
+
+/********************* Functions ************************************/
+
+// turn the LED on and schedule turning it off
+void blink() {
+	digitalWrite(LED_PIN, ON);
+	offTimer = Timers.schedule(turnOffLED, 200);				// no named task needed
+}
+
+void turnOffLED() {
+	digitalWrite(LED_PIN, OFF);
+}
+
+// schedule a countdown, one timer per number, then cancel one of them
+void countdown() {
+	SchedHandle handles[3];
+	for (int i=0; i<3; i++) {
+		handles[i] = Timers.schedule(say, (i + 1) * 300UL, 3 - i); // say 3, 2, 1
+	}
+	Timers.cancel(handles[1]);										// skip "2"
+
+	if (OUTPUT_ENABLED) {
+		Serial << "\n" << millis() << " countdown, " << Timers.getFree() << " timers free";
+		Serial << ", stale cancel " << (Timers.cancel(offTimer) ? "cancelled!" : "ignored"); // offTimer ran long ago
+	}
+}
+
+void say(int n) {
+	if (OUTPUT_ENABLED) Serial << "\n" << millis() << " " << n;
+}
@@ -0,0 +1,87 @@
+// Example_17 - stagger periodic tasks to flatten the peak load
+
+/*
+	Ten tasks start together with periods of 100, 200 and 500 ms, so every second all ten fall due in the same
+	pass of the dispatcher.  SchedPhase::plan() moves each task within its period so that as few as possible
+	fall due together.  SchedPhase::setAuto(true) re-places a task when its period is changed; the dispatcher's
+	idle hook from SchedPhase does the work once a pass has nothing to dispatch.
+
+	The sketch prints the predicted peak (tasks in the busiest slot) before and after planning, and every
+	5 seconds the largest number of tasks actually dispatched in the same millisecond.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+	2026-10-19 re-placing done by the SchedPhase idle hook
+*/
+
+const char CAPTION[] = "Example 17 phase staggering";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedPhase.h>
+
+void work();															// forward declarations
+void report();
+void changePeriod();
+
+SchedTask Tasks[] = {													// ten tasks, all due NOW
+	SchedTask(NOW, 100, work), SchedTask(NOW, 100, work), SchedTask(NOW, 100, work), SchedTask(NOW, 100, work),
+	SchedTask(NOW, 200, work), SchedTask(NOW, 200, work), SchedTask(NOW, 200, work),
+	SchedTask(NOW, 500, work), SchedTask(NOW, 500, work), SchedTask(NOW, 500, work)
+};
+
+SchedTask ReportTask (5000, 5000, report);						// print the measured peak every 5 seconds
+SchedTask ChangeTask (12000, ONESHOT, changePeriod);		// change a period after 12 seconds
+
+unsigned long lastMillis;											// millis() of the latest work() call
+int together;															// work() calls in that millisecond
+int most;																// largest value of together
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	ReportTask.setPeriod(ONESHOT);								// keep the report tasks out of the plan
+	ChangeTask.setNext(NEVER);
+	Serial << "\npeak before planning " << SchedPhase::peak();
+	SchedPhase::plan();
+	Serial << "\npeak after planning  " << SchedPhase::peak();
+	ReportTask.setPeriod(5000);									// now start them
+	ReportTask.setNext(5000);
+	ChangeTask.setNext(12000);
+
+	SchedPhase::setAuto(true);										// keep it planned when periods change
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher<SchedPhase>();						// re-places changed tasks when a pass is idle
+}
+
+/********************* Functions ************************************/
+
+// the periodic work; count how many calls share the same millisecond
+void work() {
+	unsigned long now = millis();
+	if (now == lastMillis) together++;
+	else together = 1;
+	lastMillis = now;
+	if (together > most) most = together;
+}
+
+void report() {
+	if (OUTPUT_ENABLED) Serial << "\n" << millis() << " most tasks in one ms: " << most;
+	most = 0;
+}
+
+// change one period; setAuto(true) has the task re-placed after this pass
+void changePeriod() {
+	Tasks[0].setPeriod(300);
+	if (OUTPUT_ENABLED) Serial << "\n" << millis() << " Tasks[0] period now 300 ms, peak before re-placing " << SchedPhase::peak();
+}
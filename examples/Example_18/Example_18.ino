@@ -0,0 +1,73 @@
+// Example_18 - one task for many channels with SchedTaskGroup
+
+/*
+	Rather than one SchedTaskT per LED with the same function and period, a SchedTaskGroup holds all the LEDs
+	and calls the function once per period with the array of them.  Here 8 channels toggle together every
+	500 ms.  Every 4 seconds one channel is disabled (and the previous one enabled again) without disturbing
+	the others; the function is then called once for each run of enabled channels.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+*/
+
+const char CAPTION[] = "Example 18 task group for many channels";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedTaskGroup.h>
+
+const int CHANNELS = 8;
+
+struct channel {														// one LED
+	int pin;
+	int state;
+};
+
+void toggle(channel*, int);										// forward declarations
+void rotate();
+
+SchedTaskGroup<channel, CHANNELS> Blinkers (NOW, 500, toggle); // all channels, every 500 ms
+SchedTask RotateTask (4000, 4000, rotate);						// change which channel is off
+
+int off = -1;															// channel currently disabled
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	for (int i=0; i<CHANNELS; i++) {
+		channel ch = {2 + i, OFF};									// LEDs on pins 2 to 9
+		pinMode(ch.pin, OUTPUT);
+		Blinkers.add(ch);
+	}
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher();
+}
+
+/********************* Functions ************************************/
+
+// toggle a run of enabled channels
+void toggle(channel* ch, int count) {
+	for (int i=0; i<count; i++) {
+		ch[i].state = (ch[i].state == ON) ? OFF : ON;
+		digitalWrite(ch[i].pin, ch[i].state);
+	}
+	if (OUTPUT_ENABLED) Serial << "\n" << millis() << " channels " << (ch - Blinkers.getParms()) << " to " << (ch - Blinkers.getParms()) + count - 1;
+}
+
+// disable the next channel, enable the previous one
+void rotate() {
+	if (off >= 0) Blinkers.enable(off);
+	off = (off + 1) % CHANNELS;
+	Blinkers.disable(off);
+	digitalWrite(Blinkers.getParm(off).pin, OFF);
+}
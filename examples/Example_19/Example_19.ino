@@ -0,0 +1,76 @@
+// Example_19 - stretch low value tasks under load with SchedElastic
+
+/*
+	StatusTask and TelemetryTask declare a period range with SchedElastic::add().  Between 5 and 15 seconds the
+	control task takes far longer than usual and the sketch is overloaded; SchedElastic stretches the two
+	elastic tasks toward their longest periods and restores them once the load drops.  The control task keeps
+	its period throughout.
+
+	Each second the measured utilization, the stretch level and the periods in effect are printed.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+*/
+
+const char CAPTION[] = "Example 19 elastic periods";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedElastic.h>
+
+void control();														// forward declarations
+void status();
+void telemetry();
+void report();
+
+SchedTask ControlTask (NOW, 50, control);						// fixed period
+SchedTask StatusTask (NOW, 100, status);						// elastic, see setup()
+SchedTask TelemetryTask (NOW, 200, telemetry);				// elastic, see setup()
+SchedTask ReportTask (1000, 1000, report);
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	pinMode(LED_PIN, OUTPUT);
+	SchedElastic::add(StatusTask, 100, 1000);					// every 100 ms, or as slow as every second
+	SchedElastic::add(TelemetryTask, 200, 2000);
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher<SchedElastic>();						// dispatch and measure the load
+}
+
+/********************* Functions ************************************/
+
+// the important work; heavy between 5 and 15 seconds
+void control() {
+	unsigned long now = millis();
+	if (now > 5000 && now < 15000) delayMicroseconds(45000);
+	else delayMicroseconds(5000);
+}
+
+void status() {
+	static int state = OFF;
+	state = (state == ON) ? OFF : ON;
+	digitalWrite(LED_PIN, state);
+	delayMicroseconds(2000);
+}
+
+void telemetry() {
+	delayMicroseconds(5000);
+}
+
+void report() {
+	if (OUTPUT_ENABLED) {
+		Serial << "\n" << millis() << " load " << SchedElastic::getUtilization() << "% level " << SchedElastic::getLevel();
+		Serial << " status " << StatusTask.getPeriod() << " ms, telemetry " << TelemetryTask.getPeriod() << " ms";
+	}
+}
@@ -0,0 +1,103 @@
+// Example_20 - long jobs in the background with SchedBackground
+
+/*
+	A checksum over a large block of data and a slow "display redraw" are too long to be dispatched functions.
+	They are queued with SchedBackground and done a small piece at a time, only in the idle time before the next
+	task is due.  A task every 10 ms records how late it is dispatched, to show the background work does not
+	delay it by more than one piece of work.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+*/
+
+const char CAPTION[] = "Example 20 background jobs";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedBackground.h>
+
+const unsigned int DATA_SIZE = 32768;							// bytes to checksum
+const unsigned int BLOCK = 64;										// bytes per piece of work
+const int LINES = 40;													// display lines to redraw
+
+struct checksumJob {													// state of a checksum in progress
+	unsigned int position;
+	unsigned int sum;
+};
+
+bool checksum(void*);													// forward declarations
+bool redraw(void*);
+void control();
+void report();
+
+SchedTask ControlTask (NOW, 10, control);						// timed work that must stay on time
+SchedTask ReportTask (2000, 2000, report);
+
+checksumJob job;
+int line;																// next display line to redraw
+unsigned long maxLate;												// worst lateness of ControlTask
+unsigned long checksums;											// checksums completed
+unsigned long redraws;												// redraws completed
+bool redrawing;														// redraw job queued
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	SchedBackground::add(checksum, &job);
+	redrawing = SchedBackground::add(redraw);
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher<SchedBackground>();					// background jobs run after idle passes
+}
+
+/********************* Functions ************************************/
+
+// one block of the checksum; the data here is made up from the position
+bool checksum(void* parm) {
+	checksumJob* j = (checksumJob*)parm;
+	for (unsigned int i=0; i<BLOCK; i++, j->position++) {
+		j->sum = (j->sum << 1 | j->sum >> 15) ^ (j->position * 31 + 7);
+	}
+	if (j->position < DATA_SIZE) return true;					// more to do
+	checksums++;
+	return false;															// done, off the queue
+}
+
+// redraw one line of a slow display
+bool redraw(void*) {
+	delayMicroseconds(300);											// pretend to talk to the display
+	if (++line < LINES) return true;
+	line = 0;
+	redraws++;
+	redrawing = false;
+	return false;
+}
+
+void control() {
+	unsigned long late = millis() - (ControlTask.getNext() - ControlTask.getPeriod());
+	if (late > maxLate) maxLate = late;
+}
+
+// report and queue the jobs again once they're done
+void report() {
+	if (OUTPUT_ENABLED) {
+		Serial << "\n" << millis() << " checksums " << checksums << " (last " << job.sum << ") redraws " << redraws;
+		Serial << ", control task at most " << maxLate << " ms late";
+	}
+	maxLate = 0;
+	if (job.position >= DATA_SIZE) {
+		job.position = 0;
+		job.sum = 0;
+		SchedBackground::add(checksum, &job);
+	}
+	if (!redrawing) redrawing = SchedBackground::add(redraw);
+}
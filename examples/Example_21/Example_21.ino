@@ -0,0 +1,97 @@
+// Example_21 - warm restart with SchedSnapshot
+
+/*
+	Three tasks run with different periods and phases; one has a limited number of iterations.  Every 2 seconds
+	the timing of all tasks is saved with SchedSnapshot.  At 5.5 seconds the sketch fakes a reset by putting the
+	tasks back to their constructor values, then restores the last snapshot: the tasks carry on with the phases
+	and the remaining iterations they had at the save instead of all starting again together.
+
+	The snapshot is kept in RAM here.  On an AVR it would normally go to EEPROM:
+
+		for (size_t i=0; i<n; i++) EEPROM.update(i, buf[i]);		// save
+		for (size_t i=0; i<n; i++) buf[i] = EEPROM.read(i);		// after the reset
+
+	On an ESP32 RTC_DATA_ATTR memory keeps it through deep sleep; pass the sleep time to restore().
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+*/
+
+const char CAPTION[] = "Example 21 warm restart";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedSnapshot.h>
+
+void fast();															// forward declarations
+void slow();
+void limited();
+void save();
+void reset();
+void show();
+
+SchedTask FastTask (100, 300, fast);							// the three tasks to keep in step
+SchedTask SlowTask (250, 1000, slow);
+SchedTask LimitedTask (400, 700, 10, limited);			// ten dispatches only
+SchedTask SaveTask (2000, 2000, save);							// snapshot every 2 seconds
+SchedTask ResetTask (5500, ONESHOT, reset);					// fake a reset once
+
+uint8_t buf[80];														// the saved snapshot
+size_t saved;															// bytes in buf
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+	Serial << "snapshot size " << SchedSnapshot::size() << " bytes\n";
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher();
+}
+
+/****************** Task dispatched functions ************/
+
+void fast() {
+	Serial << millis() << " fast\n";
+}
+
+void slow() {
+	Serial << millis() << " slow\n";
+}
+
+void limited() {
+	Serial << millis() << " limited, " << LimitedTask.getIterations() << " left\n";
+}
+
+void save() {
+	saved = SchedSnapshot::save(buf, sizeof(buf));
+	Serial << millis() << " saved " << saved << " bytes\n";
+}
+
+void reset() {
+	Serial << millis() << " reset, before:\n";
+	show();
+	FastTask.setNext(100);											// back to the constructor values
+	SlowTask.setNext(250);
+	LimitedTask.setNext(400);
+	LimitedTask.setIterations(10);
+	int restored = SchedSnapshot::restore(buf, saved);
+	ResetTask.setNext(NEVER);										// the fake reset is not part of the sketch
+	Serial << "restored " << restored << " tasks, after:\n";
+	show();
+}
+
+void show() {
+	unsigned long now = millis();
+	Serial << "  fast due in " << FastTask.getNext() - now
+		<< ", slow due in " << SlowTask.getNext() - now
+		<< ", limited due in " << LimitedTask.getNext() - now
+		<< " with " << LimitedTask.getIterations() << " left\n";
+}
@@ -0,0 +1,84 @@
+// Example_22 - task telemetry with SchedTelemetry
+
+/*
+	Twelve tasks blink, sample and count.  Every 100 ms a task starts a SchedTelemetry frame holding the state of
+	every task; the frame goes out over Serial in the idle time, a few bytes at a time, so no task waits for it.
+	SchedProfiler counts the dispatches of each task for the frame.
+
+	The output is binary.  Close the Serial Monitor and decode it on the host with
+		python3 extras/sched_telemetry.py /dev/ttyUSB0 115200
+	(UART_SPEED in ExampleConstants.h must match).  To see the task names set SCHED_NAMES to 1 in SchedConfig.h
+	(or in the build flags); the names frame is sent once at the start.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+*/
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedTaskT.h>
+#include <SchedTelemetry.h>
+
+const int CHANNELS = 8;
+
+void blink(int);														// forward declarations
+void sample();
+void count();
+void telemetry();
+
+SchedTaskT<int> Blink0 (NOW, 100, blink, 0);					// one blinker per channel, different rates
+SchedTaskT<int> Blink1 (NOW, 150, blink, 1);
+SchedTaskT<int> Blink2 (NOW, 200, blink, 2);
+SchedTaskT<int> Blink3 (NOW, 250, blink, 3);
+SchedTaskT<int> Blink4 (NOW, 300, blink, 4);
+SchedTaskT<int> Blink5 (NOW, 400, blink, 5);
+SchedTaskT<int> Blink6 (NOW, 500, blink, 6);
+SchedTaskT<int> Blink7 (NOW, 1000, blink, 7);
+SchedTaskT<int>* Blink[CHANNELS] = {&Blink0, &Blink1, &Blink2, &Blink3, &Blink4, &Blink5, &Blink6, &Blink7};
+SchedTask SampleTask (NOW, 20, sample);
+SchedTask CountTask (1000, 1000, 10, count);					// ten times only
+SchedTask Later (NEVER, ONESHOT, count);						// never started
+SchedTask TelemetryTask (50, 100, telemetry);
+
+bool level[CHANNELS];
+int samples;
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// binary output: no welcome message
+
+	SampleTask.setName("sample");
+	CountTask.setName("count");
+	Later.setName("later");
+	TelemetryTask.setName("telemetry");
+	for (int i=0; i<CHANNELS; i++) Blink[i]->setName("blink");
+	SchedTelemetry::sendNames(Serial);
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher<SchedHookChain<SchedProfiler, SchedTelemetry> >(); // count dispatches, send telemetry when idle
+}
+
+/****************** Task dispatched functions ************/
+
+void blink(int ch) {
+	level[ch] = !level[ch];
+}
+
+void sample() {
+	samples++;
+}
+
+void count() {
+	samples = 0;
+}
+
+void telemetry() {
+	SchedTelemetry::send(Serial);									// skipped if the last frame has not gone yet
+}
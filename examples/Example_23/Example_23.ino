@@ -0,0 +1,82 @@
+// Example_23 - suspending a group of tasks with SchedGroup
+
+/*
+	Needs SCHED_GROUPS set to 1 in SchedConfig.h (or in the build flags).
+
+	Three motor tasks run at different rates and phases in the SchedGroup Motors; a sensor task runs on its own.
+	At 1.05 seconds the motors are suspended for a 700 ms "calibration" while the sensor carries on.  On resume each
+	motor task picks up where it was, with the same phase to the others.  At 3 seconds the whole group is shifted
+	50 ms later.  Each group operation costs the same however many members the group has.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+*/
+
+const char CAPTION[] = "Example 23 task groups";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedTaskT.h>
+#include <SchedGroup.h>
+
+void motor(char);														// forward declarations
+void sensor();
+void calibrate();
+void calibrated();
+void shift();
+
+SchedTaskT<char> MotorA (100, 300, motor, 'A');				// the motor tasks
+SchedTaskT<char> MotorB (200, 300, motor, 'B');
+SchedTaskT<char> MotorC (150, 600, motor, 'C');
+SchedTask SensorTask (NOW, 250, sensor);						// not in the group
+SchedTask CalibrateTask (1050, ONESHOT, calibrate);
+SchedTask CalibratedTask (NEVER, ONESHOT, calibrated);
+SchedTask ShiftTask (3000, ONESHOT, shift);
+
+SchedGroup Motors ("motors");
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	Motors.add(MotorA);
+	Motors.add(MotorB);
+	Motors.add(MotorC);
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher();
+}
+
+/****************** Task dispatched functions ************/
+
+void motor(char m) {
+	Serial << millis() << " motor " << m << '\n';
+}
+
+void sensor() {
+	Serial << millis() << " sensor\n";
+}
+
+void calibrate() {
+	Serial << millis() << " suspend " << Motors.getName() << ", A due in " << MotorA.getNext() - millis() << '\n';
+	Motors.suspend();
+	CalibratedTask.setNext(700);
+}
+
+void calibrated() {
+	Motors.resume();
+	Serial << millis() << " resume " << Motors.getName() << ", A due in " << MotorA.getNext() - millis() << '\n';
+}
+
+void shift() {
+	Motors.shift(50);
+	Serial << millis() << " shift " << Motors.getName() << " by 50 ms\n";
+}
@@ -0,0 +1,89 @@
+// Example_24 - a cyclic executive built when compiling with SchedCyclic
+
+/*
+	Four periodic functions with fixed periods and offsets make up a SchedCyclic.  The schedule (a 10 ms minor
+	frame repeating every 300 ms) is worked out by the compiler, and the Dispatcher calls the functions listed for
+	each frame without looking at them one by one.  A normal SchedTask reports the counts every second alongside.
+
+	Uncomment BAD_SET to see a set whose functions can take longer than one frame fail to compile.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+*/
+
+const char CAPTION[] = "Example 24 compile time cyclic executive";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedCyclic.h>
+
+void sample();															// forward declarations
+void filter();
+void control();
+void logData();
+void report();
+
+SchedCyclic<10,														// 10 ms minor frame
+	SchedEntry<sample, 10, 0, 1000>,								// every frame, up to 1 ms
+	SchedEntry<filter, 20, 10, 2000>,							// every other frame, between the controls
+	SchedEntry<control, 20, 0, 3000>,
+	SchedEntry<logData, 300, 150, 4000>							// once a hyperperiod, half way through
+> Executive;
+
+//#define BAD_SET
+#ifdef BAD_SET
+SchedCyclic<10,
+	SchedEntry<sample, 10, 0, 6000>,
+	SchedEntry<control, 20, 0, 6000>								// 12 ms of work in a 10 ms frame: does not compile
+> Overloaded;
+#endif
+
+SchedTask ReportTask (1000, 1000, report);						// an ordinary task alongside
+
+unsigned long samples, filters, controls, logs;
+unsigned long lastControl;											// time of the last control()
+unsigned long maxControlGap;
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+	Serial << "minor frame " << Executive.FRAME << " ms, hyperperiod " << Executive.HYPERPERIOD
+		<< " ms, " << Executive.SLOTS << " frames, heaviest frame " << Executive.PEAK << " us\n";
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher();
+}
+
+/****************** Task dispatched functions ************/
+
+void sample() {
+	samples++;
+}
+
+void filter() {
+	filters++;
+}
+
+void control() {
+	unsigned long now = millis();
+	if (controls && now - lastControl > maxControlGap) maxControlGap = now - lastControl;
+	lastControl = now;
+	controls++;
+}
+
+void logData() {
+	logs++;
+}
+
+void report() {
+	Serial << millis() << " samples " << samples << ", filters " << filters << ", controls " << controls
+		<< ", logs " << logs << ", longest gap between controls " << maxControlGap << " ms\n";
+}
@@ -0,0 +1,89 @@
+// Example_25 - blink LED with one SchedDuty task
+
+/*
+	The LED is on for 200 ms and off for 800 ms, five times, using one SchedDuty task instead of the separate on
+	and off tasks of Example 11.  A second SchedDuty runs a 30 ms pulse every 100 ms indefinitely and counts the
+	edges; after 3 seconds its times are changed to 50/50.  A third task wastes a few ms now and then to show that
+	late dispatches make single edges late (the on times measured vary) but do not make the edges drift: the pulse
+	count keeps exact time.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+*/
+
+const char CAPTION[] = "Example 25 duty cycle task";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedDuty.h>
+
+void led(bool);														// forward declarations
+void pulse(bool);
+void busy();
+void change();
+void report();
+
+SchedDuty Blink (NOW, 200, 800, 5, led);						// 200 ms on, 800 ms off, 5 times
+SchedDuty Pulse (NOW, 30, 70, pulse);							// 30 ms on, 70 ms off, forever
+SchedTask BusyTask (5, 370, busy);								// late dispatches now and then
+SchedTask ChangeTask (3000, ONESHOT, change);
+SchedTask ReportTask (1000, 1000, report);
+
+unsigned long pulses;													// rising edges of Pulse
+unsigned long onAt;													// when the current pulse started
+unsigned long shortest = 0xFFFFFFFFUL, longest;			// on times measured
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	pinMode(LED_PIN, OUTPUT);										// initialize the hardware pin for LED
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	SchedBase::dispatcher();										// dispatch any tasks due
+}
+
+/********************* Functions ************************************/
+
+// LED edge
+void led(bool on) {
+	digitalWrite(LED_PIN, on ? ON : OFF);
+	if (OUTPUT_ENABLED) Serial << millis() << (on ? " On" : " Off") << '\n';
+}
+
+// pulse edge: count the pulses and measure how long each one lasts
+void pulse(bool on) {
+	if (on) {
+		pulses++;
+		onAt = millis();
+	}
+	else {
+		unsigned long length = millis() - onAt;
+		if (length < shortest) shortest = length;
+		if (length > longest) longest = length;
+	}
+}
+
+// take a few ms
+void busy() {
+	delay(7);
+}
+
+void change() {
+	Pulse.setTimes(50, 50);
+	Serial << millis() << " pulse now 50/50\n";
+}
+
+void report() {
+	Serial << millis() << " pulses " << pulses << ", on for " << shortest << " to " << longest << " ms\n";
+	shortest = 0xFFFFFFFFUL;
+	longest = 0;
+}
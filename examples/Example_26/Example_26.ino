@@ -0,0 +1,94 @@
+// Example_26 - record two seconds of dispatching and replay it with SchedRecorder and SchedReplay
+
+/*
+	Needs SCHED_RECORD set to 1 in SchedConfig.h (or in the build flags).
+
+	Five tasks run while SchedRecorder logs what the dispatcher sees.  Every so often loop() "presses a button"
+	(an input the replay can't see): it notes the press with mark(), starts the alarm task and changes the period
+	of the slow task.  After two seconds recording stops and SchedReplay runs the log back through the same
+	dispatcher.  Two tasks run out of iterations and retire during the recording, one of them the last task the
+	dispatcher looks at in a pass.  Each dispatched function adds its task and the time to a checksum, and the checksums of the
+	recording and the replay should match.  In practice the log would be sent to a PC and replayed there.
+
+	For the complete series of tutorials see
+	https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+Change Log
+	2026-10-19 Initial Release
+	2026-10-19 retirement at the end of a pass
+*/
+
+const char CAPTION[] = "Example 26 record and replay";
+
+#include <ExampleConstants.h>										// contains various constants used to control the sketch behavior
+#include <SchedTask.h>
+#include <SchedTaskT.h>
+#include <SchedRecorder.h>
+#include <SchedReplay.h>
+
+const uint8_t BUTTON = 1;											// mark() code
+const unsigned long RECORD_TIME = 2000;
+
+void work(char);														// forward declarations
+void pressed(uint8_t, unsigned long);
+
+SchedTaskT<char> Burst (3, 10, 2, work, 'B');				// constructed first, so last in the list: retires at the end of a pass
+SchedTaskT<char> Fast (NOW, 20, work, 'F');
+SchedTaskT<char> Slow (5, 50, work, 'S');
+SchedTaskT<char> Limited (10, 30, 8, work, 'L');				// eight dispatches only
+SchedTaskT<char> Alarm (NEVER, ONESHOT, work, 'A');			// started by the button
+
+uint8_t record[1200];													// the log
+bool recording;
+unsigned long started;
+unsigned long loops;
+unsigned long dispatches;											// dispatches seen and a checksum of them
+unsigned long sum;
+
+/********************  Setup() **************************/
+void setup() {
+
+	Serial.begin(UART_SPEED);										// init the Monitor window
+	Serial << "\n*** SchedTask " << CAPTION << " ***\n";	// Welcome message to monitor
+
+	started = millis();
+	SchedRecorder::begin(record, sizeof(record));
+	recording = true;
+}
+
+/******************* Loop() ********************************/
+
+void loop() {
+	if (!recording) return;
+
+	SchedRecorder::dispatcher();									// instead of SchedBase::dispatcher()
+	if (++loops % 337 == 0) {										// a button press at a moment the replay can't predict
+		SchedRecorder::mark(BUTTON, loops);
+		Alarm.setNext(NOW);
+		Slow.setPeriod(Slow.getPeriod() == 50 ? 35 : 50);
+	}
+
+	if (millis() - started >= RECORD_TIME) {
+		SchedRecorder::end();
+		recording = false;
+		Serial << "recorded " << dispatches << " dispatches, checksum " << sum << ", log "
+			<< SchedRecorder::getLength() << " bytes" << (SchedRecorder::isFull() ? " (full)" : "") << '\n';
+
+		dispatches = 0;
+		sum = 0;
+		bool ok = SchedReplay::run(record, SchedRecorder::getLength(), pressed);
+		Serial << "replayed " << dispatches << " dispatches, checksum " << sum << ", " << SchedReplay::getPasses()
+			<< " passes" << (ok ? "" : " (lost track)") << '\n';
+	}
+}
+
+/********************* Functions ************************************/
+
+void work(char id) {
+	dispatches++;
+	sum = sum * 31 + id + SchedBase::getTime();				// the time as the dispatcher sees it
+}
+
+void pressed(uint8_t code, unsigned long value) {
+	if (OUTPUT_ENABLED) Serial << "  replay: button press " << code << " at loop " << value << '\n';
+}
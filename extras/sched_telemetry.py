@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Decode SchedTelemetry frames (see src/SchedTelemetry.h).
+
+    python3 sched_telemetry.py /dev/ttyUSB0 115200    # needs pyserial
+    python3 sched_telemetry.py capture.bin            # a file of captured output
+    python3 sched_telemetry.py -                      # standard input
+
+Prints a table of every task for each state frame received.  Names come from a names frame, if one was sent.
+"""
+
+import struct
+import sys
+
+SYNC = b"\xa5\x5a"
+STATE = 1
+NAMES = 2
+STATE_RECORD = 11
+
+ACTIVE = 0x01
+DUE = 0x02
+CLAMPED = 0x04
+SUSPENDED = 0x08
+
+
+def fletcher16(data):
+    a = b = 0
+    for byte in data:
+        a = (a + byte) % 255
+        b = (b + a) % 255
+    return b << 8 | a
+
+
+def period_ms(period):
+    return (period & 0x7FFF) * 1000 if period & 0x8000 else period
+
+
+class Decoder:
+    """Feed bytes in with feed(); complete frames come back as (type, seq, records)."""
+
+    def __init__(self):
+        self.buf = bytearray()
+        self.bad = 0
+
+    def feed(self, data):
+        self.buf += data
+        frames = []
+        while True:
+            start = self.buf.find(SYNC)
+            if start < 0:
+                del self.buf[:-1]
+                return frames
+            del self.buf[:start]
+            frame = self._parse()
+            if frame is None:
+                return frames          # need more bytes
+            if frame is False:
+                self.bad += 1
+                del self.buf[:1]       # not a frame after all; look for the next sync
+                continue
+            frames.append(frame)
+
+    def _parse(self):
+        buf = self.buf
+        if len(buf) < 6:
+            return None
+        ftype, seq, count = struct.unpack_from("<BBH", buf, 2)
+        if ftype == STATE:
+            end = 6 + count * STATE_RECORD
+        elif ftype == NAMES:
+            end = 6
+            for _ in range(count):
+                if len(buf) < end + 3:
+                    return None
+                end += 3 + buf[end + 2]
+        else:
+            return False
+        if len(buf) < end + 2:
+            return None
+        (check,) = struct.unpack_from("<H", buf, end)
+        if check != fletcher16(buf[2:end]):
+            return False
+        records = []
+        pos = 6
+        for _ in range(count):
+            if ftype == STATE:
+                records.append(struct.unpack_from("<HBhHhH", buf, pos))
+                pos += STATE_RECORD
+            else:
+                tid, length = struct.unpack_from("<HB", buf, pos)
+                records.append((tid, bytes(buf[pos + 3:pos + 3 + length]).decode("ascii", "replace")))
+                pos += 3 + length
+        del buf[:end + 2]
+        return ftype, seq, records
+
+
+def show(seq, records, names):
+    print("frame %d, %d tasks" % (seq, len(records)))
+    print("   id name              state      next   period  iter  count")
+    for tid, flags, nxt, period, iterations, count in sorted(records):
+        if tid == 0xFFFF:
+            continue
+        if not flags & ACTIVE:
+            state, nxt = "idle", "-"
+        else:
+            state = "suspended" if flags & SUSPENDED else "due" if flags & DUE else "waiting"
+            nxt = ("%s%d" % (">" if flags & CLAMPED and nxt > 0 else "<" if flags & CLAMPED else "", nxt))
+        print("%5d %-16s %-9s %6s %8d %5d %6d" % (tid, names.get(tid, ""), state, nxt, period_ms(period),
+                                                  iterations, count))
+    print()
+
+
+def source(args):
+    if not args or args[0] == "-":
+        stream = sys.stdin.buffer
+        return lambda: stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+    if len(args) > 1 or args[0].startswith(("/dev/", "COM")):
+        import serial                  # pyserial
+        port = serial.Serial(args[0], int(args[1]) if len(args) > 1 else 115200, timeout=0.1)
+        return lambda: port.read(4096) or None
+    stream = open(args[0], "rb")
+    return lambda: stream.read(4096)
+
+
+def main(args):
+    read = source(args)
+    decoder = Decoder()
+    names = {}
+    live = len(args) > 1 or (args and args[0].startswith(("/dev/", "COM")))
+    while True:
+        data = read()
+        if data is None:               # serial timeout: keep waiting
+            continue
+        if not data and not live:
+            break
+        for ftype, seq, records in decoder.feed(data):
+            if ftype == NAMES:
+                names = dict(records)
+            else:
+                show(seq, records, names)
+    if decoder.bad:
+        print("%d bad frames skipped" % decoder.bad, file=sys.stderr)
+
+
+if __name__ == "__main__":
+    try:
+        main(sys.argv[1:])
+    except KeyboardInterrupt:
+        pass
@@ -0,0 +1,79 @@
+/*
+	SchedBackground.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 a job that removes itself is not counted off twice
+		2026-10-19 time differences taken in 32 bits
+*/
+
+#include <SchedBackground.h>
+
+SchedBackground::Job SchedBackground::jobs[SCHED_BACKGROUND_JOBS];
+int SchedBackground::count = 0;
+int SchedBackground::current = 0;
+unsigned long SchedBackground::slice = 2000;
+unsigned long SchedBackground::guard = 1;
+unsigned long SchedBackground::sliceStart = 0;
+unsigned long SchedBackground::budget = 0;
+
+// add()
+bool SchedBackground::add(pJob job, void* parm) {
+	for (int i=0; i<SCHED_BACKGROUND_JOBS; i++) {
+		if (!jobs[i].job) {
+			jobs[i].job = job;
+			jobs[i].parm = parm;
+			count++;
+			return true;
+		}
+	}
+	return false;															// queue full
+}
+// remove()
+bool SchedBackground::remove(pJob job, void* parm) {
+	for (int i=0; i<SCHED_BACKGROUND_JOBS; i++) {
+		if (jobs[i].job == job && jobs[i].parm == parm) {
+			jobs[i].job = nullptr;
+			count--;
+			return true;
+		}
+	}
+	return false;
+}
+// timeLeft()
+unsigned long SchedBackground::timeLeft() {
+	unsigned long used = micros() - sliceStart;
+	return used < budget ? budget - used : 0;
+}
+// run()
+void SchedBackground::run() {
+	if (!count) return;
+
+	budget = slice;
+	unsigned long when;
+	if (SchedBase::getEarliest(when)) {							// leave time for the next task
+		signed long slack = (int32_t)(when - SchedBase::getTime()) - (signed long)guard;
+		if (slack <= 0) return;											// a task is about to be due
+		if ((unsigned long)slack < budget / 1000) budget = slack * 1000UL;
+	}
+	sliceStart = micros();
+
+	int idle = 0;															// jobs in a row found empty
+	while (count && timeLeft() && idle < SCHED_BACKGROUND_JOBS) {
+		Job& j = jobs[current];
+		current = (current + 1) % SCHED_BACKGROUND_JOBS;		// take turns
+		if (!j.job) {
+			idle++;
+			continue;
+		}
+		idle = 0;
+		pJob job = j.job;
+		void* parm = j.parm;
+		bool more = job(parm);											// one piece of work; false when finished
+		if (!more && j.job == job && j.parm == parm) {			// unless the job already took itself off with remove()
+			j.job = nullptr;
+			count--;
+		}
+	}
+}
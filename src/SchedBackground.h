@@ -0,0 +1,75 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedBackground.h - long running jobs done a piece at a time in the idle time between tasks
+
+Dispatched functions should be short.  Long jobs (logging to flash, computing a checksum, redrawing a display)
+can instead be queued with SchedBackground and are run only in the slack before the next task falls due.
+
+A job is a function that does one small piece of the work each time it is called and returns true while there is
+more to do, false when it is finished (it is then removed from the queue):
+
+	bool checksum(void* parm) {...one block...; return moreBlocks;}
+
+	SchedBackground::add(checksum);								// or add(checksum, &someData) to pass a pointer
+
+Run the jobs from loop(), either as the idle hook of the dispatcher (jobs run only after a pass that dispatched
+nothing) or by calling run() yourself:
+
+	SchedBase::dispatcher<SchedBackground>();					// or
+	SchedBase::dispatcher();  SchedBackground::run();
+
+Each run() gives the jobs a time slice (setSlice(), 2000 us by default), shortened so that it ends a guard time
+(setGuard(), 1 ms by default) before the next task is due.  The jobs take turns, one piece at a time, until the
+slice is used up.  A job can call timeLeft() to size its piece of work.  Nothing runs if a task is due within the
+guard time.
+
+Up to SCHED_BACKGROUND_JOBS jobs can be queued (see SchedConfig.h).
+
+	Change log
+
+		2026-10-19 initial coding
+*/
+
+#ifndef SchedBackground_h
+#define SchedBackground_h
+
+#include <SchedBase.h>
+
+class SchedBackground {
+	typedef bool (*pJob)(void*);	// pJob is of Type pointer to a function that takes a pointer and returns true while there's more to do
+
+	public:
+
+		static bool add(pJob job, void* parm = nullptr);		// queue a job; false if the queue is full
+		static bool remove(pJob job, void* parm = nullptr);	// take a job off the queue; false if it wasn't there
+		static int getCount() {return count;}						// jobs queued
+		static void run();												// run jobs in the slack before the next task
+		static unsigned long timeLeft();								// us left in the current slice
+		static void setSlice(unsigned long us) {slice = us;}	// longest time run() spends
+		static void setGuard(unsigned long ms) {guard = ms;}	// stop this long before the next task is due
+
+		static void preDispatch(SchedBase*) {}						// dispatch hooks: run the jobs after an idle pass
+		static void postDispatch(SchedBase*) {}
+		static void idle() {run();}
+
+	private:
+
+		struct Job {
+			pJob job;
+			void* parm;
+		};
+		static Job jobs[SCHED_BACKGROUND_JOBS];					// queued jobs (job is nullptr when unused)
+		static int count;													// jobs queued
+		static int current;												// next job to run (round robin)
+		static unsigned long slice;									// us
+		static unsigned long guard;									// ms
+		static unsigned long sliceStart;								// micros() when the current run() started
+		static unsigned long budget;									// us the current run() may use
+};
+
+#endif
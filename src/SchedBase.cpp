@@ -11,6 +11,18 @@ https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ
 
 		10/19/2017 6:27PM initial coding
 		10/01/2020 14:38 revisions for release 1.1.0
+		2026-10-19 use replaceable clock instead of millis(); computed next never lands on NEVER; getEarliest()
+		2026-10-19 SCHED_COMPACT layout
+		2026-10-19 dispatcher body moved to SchedBase.h as dispatcher<Hooks>()
+		2026-10-19 SCHED_ROTATE cursor
+		2026-10-19 periodHook
+		2026-10-19 task names (SCHED_NAMES); times of group members are relative to the group (SCHED_GROUPS)
+		2026-10-19 setNext() notifies SchedRecorder (SCHED_RECORD)
+		2026-10-19 dispatchID
+		2026-10-19 getEarliest() compares in 32 bits
+		2026-10-19 cursorID (SCHED_ROTATE with SCHED_COMPACT)
+		2026-10-19 iterations given to the constructor go through encodeIterations()
+		2026-10-19 destructor keeps a pass in progress going (SCHED_ROTATE); unlinks tasks past the second
 */
 
 #include <SchedBase.h>
@@ -21,72 +33,111 @@ template<class T> inline Print &operator <<(Print &obj, T arg) { obj.print(arg);
 // initialize static member(s) of SchedBase class
 SchedBase* SchedBase::tasksHead = nullptr;
 int SchedBase::taskCount = 0;
+int SchedBase::dispatchID = -1;
+SchedBase::pClock SchedBase::clock = millis;
+void (*SchedBase::periodHook)(SchedBase*) = nullptr;
+#if SCHED_RECORD
+void (*SchedBase::changeHook)(SchedBase*, int) = nullptr;
+#endif
+#if SCHED_ROTATE
+SchedBase* SchedBase::cursor = nullptr;
+SchedBase* SchedBase::passStart = nullptr;
+SchedBase* SchedBase::passNext = nullptr;
+#if SCHED_COMPACT
+int SchedBase::cursorID = 0;
+#endif
+#endif
 
 // constructor definitions
-SchedBase::SchedBase (unsigned long nxt, unsigned long intval) : next(nxt), period(intval), iterations(-1)  {	// constructor definition
-	taskID = taskCount;
+SchedBase::SchedBase (unsigned long nxt, unsigned long intval) : next(nxt), period(encodePeriod(intval)), iterations(-1)  {	// constructor definition
 	addTask(this);											// add this task to the list to be dispatched
 }
-SchedBase::SchedBase (unsigned long nxt, unsigned long intval, long iters) : next(nxt), period(intval), iterations(iters)  {	// constructor definition
-	taskID = taskCount;
+SchedBase::SchedBase (unsigned long nxt, unsigned long intval, long iters) : next(nxt), period(encodePeriod(intval)), iterations(encodeIterations(iters))  {	// constructor definition
 	addTask(this);											// add this task to the list to be dispatched
 }
 SchedBase::SchedBase () : next(NEVER), period(ONESHOT), iterations(-1) {	// default constructor definition
-	taskID = taskCount;
 	addTask(this);											// add this task to the list to be dispatched
 }
 // Dispatcher
-void SchedBase::dispatcher() {										// dispatcher
-	SchedBase* pTask = tasksHead;										// point to the first task in the list
-	while (pTask) {														// loop thru the task linked list
-		if (pTask->checkFunc()) { 										// only if the function to call is valid
-			if (pTask->next != NEVER)  {								// do not dispatch if Next is NEVER
-				unsigned long now = millis();							// get the current time
-				if (pTask->iterations == 0) {							// iterations were specified and went to zero
-					pTask->next = NEVER;									// prevent future dispatches
-					pTask->iterations = -1;								// no more iterations
-					break;													// done with this task, do not dispatch
-				}
-// proceed if iterations not specified or some remaining
-				if ((signed long)(pTask->next - now) <= 0) {		// time to run the next task in the array? (see https://arduino.stackexchange.com/questions/12587/how-can-i-handle-the-millis-rollover/12588#12588)
-					if (pTask->period == ONESHOT) {					// one-shot task?
-						pTask->next = NEVER;								// ensure it won't run again
-					}
-					else {													// periodic task
-						pTask->next = pTask->next + pTask->period; // compute the next time to dispatch it (when it should have run + period)
-					}
-					if (pTask->iterations > 0) {						// iterations specified and some remaining
-						pTask->iterations--;								// decrement iterations remaining
-					}
-					pTask->callFunc();									// call the derived class function to dispatch the task
-				}
-			}
+void SchedBase::dispatcher() {										// dispatcher without hooks (see SchedBase.h for the body)
+	dispatcher<SchedNoHooks>();
+}
+// getEarliest()
+bool SchedBase::getEarliest(unsigned long& when) {				// find the earliest 'next' of all dispatchable tasks
+	bool found = false;
+	unsigned long now = clock();										// compare relative to now to stay immune from rollover
+	for (SchedBase* pTask = tasksHead; pTask; pTask = pTask->taskLink) {
+		if (pTask->isSuspended() || !pTask->checkFunc() || pTask->next == NEVER) continue; // the dispatcher would skip it
+		if (!found || (int32_t)(pTask->nextTime() - now) < (int32_t)(when - now)) {
+			when = pTask->nextTime();									// earliest so far
+			found = true;
 		}
-		pTask = pTask->taskLink;										// get link to the next task, if any
 	}
+	return found;
 }
 // addTask() to the linked list
 int SchedBase::addTask(SchedBase* pBase) {						// add a new task to the dispatch list
 		pBase->taskLink = tasksHead;									// link this task to previous head task
 		tasksHead = pBase;												// this task is now at the head
+#if SCHED_GROUPS
+		pBase->group = nullptr;											// in no group until SchedGroup::add()
+#endif
+#if SCHED_NAMES
+		pBase->name = nullptr;											// no name until setName()
+#endif
+#if SCHED_COMPACT
+		taskCount++;														// bump task count; the ID is the position in the list
+#else
 		taskID = taskCount++;											// assign task ID and bump task count
+#endif
 		return taskCount;													// update the task count and return it
 }
+#if SCHED_COMPACT
+// getTaskID()
+int SchedBase::getTaskID() {											// tasks are added at the head so the ID is the number of tasks behind this one
+	int id = 0;
+	for (SchedBase* pTask = taskLink; pTask; pTask = pTask->taskLink) {
+		id++;
+	}
+	return id;
+}
+#endif
 // setNext()
 void SchedBase::setNext(unsigned long nxt) {						// set a new NEXT value
 	if (nxt == NOW) {														// NOW?
-		next = millis();													// use current time in ms
+		next = clock() - groupOffset();								// use current time in ms (relative to the group, if any)
+		if (next == NEVER) next++;										// avoid colliding with NEVER at millis() rollover
 	}
 	else {
 		if (nxt == NEVER) {												// NEVER?
 			next = NEVER;													// use 0xFFFFFFFF
 		}
 		else {																// neither NOW nor NEVER
-			next = millis() + nxt;										// add it to current millis() time
+			next = clock() + nxt - groupOffset();					// add it to current millis() time (relative to the group, if any)
+			if (next == NEVER) next++;										// avoid colliding with NEVER at millis() rollover
 		}
 	}
+	changed();																// tell SchedRecorder, if it's listening
 }
 SchedBase::~SchedBase() {												// destructor
+#if SCHED_ROTATE
+#if SCHED_COMPACT
+	for (SchedBase* pTask = tasksHead; pTask && cursor; pTask = pTask->taskLink) {
+		if (pTask == cursor) {											// this task is behind the cursor (or is it), so the cursor's ID drops
+			cursorID--;
+			break;
+		}
+		if (pTask == this) break;
+	}
+#endif
+	if (cursor == this) cursor = taskLink;							// don't start a pass at a task that's gone
+	SchedBase* after = taskLink ? taskLink : tasksHead;		// the task after this one in a pass
+	if (after == this) after = nullptr;								// this is the only task
+	if (passStart == this) {											// a pass in progress would never get back to this task
+		passStart = passNext == after ? nullptr : after;		// being dispatched as the first of the pass: the pass starts again at the next
+	}
+	if (passNext == this) passNext = after;
+#endif
 	SchedBase* prev = tasksHead;										// init ptr to previous task
 	for (int i=0; i<taskCount; i++) {								// loop through the linked tasks
 		if (this == tasksHead) {										// destructing the first task?
@@ -101,7 +152,7 @@ SchedBase::~SchedBase() {												// destructor
 				break;														// we're done
 			}
 			else {															// this is not the one to destruct
-				prev = this;												// so update the prev task pointer to this one
+				prev = prev->taskLink;									// so move the prev task pointer on one
 			}
 		}
 	}																			// and go around again
@@ -14,12 +14,33 @@ changes:
 	10/19/2017 6:17PM initial coding
 	10/01/2020 14:37 revisions for release 1.1.0
 	10/12/2020 14:09 make callFunc and checkFunc pure virtual
+	2026-10-19 clock source can be replaced (see SchedSim.h); added getEarliest()
+	2026-10-19 compact task layout when SCHED_COMPACT is set (see SchedConfig.h)
+	2026-10-19 dispatcher<Hooks>() calls hook functions around each dispatch; dispatcher body moved here
+	2026-10-19 SchedHookChain to combine two hook classes
+	2026-10-19 a task retiring its iterations no longer ends the pass; optional rotating start (SCHED_ROTATE)
+	2026-10-19 setPeriod() notifies SchedPhase when automatic re-planning is on
+	2026-10-19 getFirstTask()/getNextTask() to walk the tasks; optional task names (SCHED_NAMES)
+	2026-10-19 optional task groups (SCHED_GROUPS): 'next' of a member is relative to its group's offset
+	2026-10-19 setters and retirement notify SchedRecorder when SCHED_RECORD is set
+	2026-10-19 getDispatchID() and getTaskID(pos) so hooks and list walks don't pay for SCHED_COMPACT's list walk
+	2026-10-19 times kept and compared in 32 bits, so a 64 bit host rolls over like the boards
+	2026-10-19 dispatch ID kept only for hooks that ask for it (wantsID); cursor ID kept with the cursor
+	2026-10-19 with SCHED_ROTATE a dispatched function may destroy tasks, itself included
+	2026-10-19 getFirstTask()/getNextTask() documented as giving the tasks themselves, not a read-only view
+	2026-10-19 a member of a suspended group takes its times from the group's current offset, as add() does
+	2026-10-19 changeHook gets the task's ID when the dispatcher retires it, so SchedRecorder needn't walk the list
+	2026-10-19 SCHED_COMPACT iterations clamped to -1 .. 32767 instead of wrapping (encodeIterations())
 */
 
 #ifndef SchedBase_h
 #define SchedBase_h
 
 #include <Arduino.h>
+#include <SchedConfig.h>
+#if SCHED_GROUPS
+#include <SchedGroup.h>
+#endif
 
 // sched task value for next = never (wait for a change to dispatch)
 #define NEVER 0xFFFFFFFF
@@ -37,8 +58,38 @@ changes:
 // sched task value for period = one shot (dispatch only once at t=next)
 #define ONESHOT 0UL
 
+class SchedBase;
+
+// hooks for dispatcher<Hooks>(); a hook class supplies all three static functions
+// SchedBase::dispatcher() uses these, which compile to nothing
+struct SchedNoHooks {
+	static void preDispatch(SchedBase*) {}						// just before a task's function is called
+	static void postDispatch(SchedBase*) {}						// just after it returns
+	static void idle() {}												// after a pass that dispatched nothing
+};
+
+// a hook class that calls SchedBase::getDispatchID() also declares 'static const bool wantsID = true;'
+// the dispatcher only keeps track of the ID for those
+template <class H, class = void> struct SchedHookWantsID {static const bool value = false;};
+template <class H> struct SchedHookWantsID<H, decltype((void)H::wantsID)> {static const bool value = H::wantsID;};
+
+// combine two hook classes, e.g. SchedBase::dispatcher<SchedHookChain<SchedProfiler, MyHooks> >()
+template <class A, class B> struct SchedHookChain {
+	static const bool wantsID = SchedHookWantsID<A>::value || SchedHookWantsID<B>::value;
+	static void preDispatch(SchedBase* task) {A::preDispatch(task); B::preDispatch(task);}
+	static void postDispatch(SchedBase* task) {B::postDispatch(task); A::postDispatch(task);} // unwind in reverse
+	static void idle() {A::idle(); B::idle();}
+};
+
 class SchedBase {
 	typedef void (*pFunc)();
+	typedef unsigned long (*pClock)();								// clock source returning milliseconds, millis() by default
+
+	friend class SchedReport;											// walks the task list
+	friend class SchedPhase;											// walks the task list and sets next
+	friend class SchedGroup;											// moves tasks in and out of groups
+	friend class SchedRecorder;										// reads the task state
+	friend class SchedReplay;											// writes the task state
 
 	public:
 
@@ -47,15 +98,44 @@ class SchedBase {
 		virtual ~SchedBase ();											// destructor
 
 		static void dispatcher ();										// see if any task is ready for dispatch (static -- no object required); call as SchedBase::dispatcher() in loop()
+		template <class Hooks> static void dispatcher ();		// same, calling Hooks around each dispatch; call as SchedBase::dispatcher<MyHooks>()
+		static bool getEarliest(unsigned long& when);			// earliest 'next' of any dispatchable task; false if none pending
+		static unsigned long getTime() {return (uint32_t)clock();} // current time as seen by the dispatcher (32 bits, as millis() on the boards)
+		static void setClock(pClock clk) {clock = clk;}			// replace the clock source (e.g. virtual time)
+		static pClock getClock() {return clock;}					// current clock source
 
 		void setNext(unsigned long nxt);								// set new Next declaration
-		void setPeriod(unsigned long per) {period = per;} 		// set a new period
-		void setIterations(int iter) {iterations = iter;}		// set the iterations
-		unsigned long getNext() {return next;}						// get Next
-		unsigned long getPeriod() {return period;}				// get Period
+		void setPeriod(unsigned long per) {period = encodePeriod(per); if (periodHook) periodHook(this); changed();} // set a new period
+		void setIterations(int iter) {iterations = encodeIterations(iter); changed();} // set the iterations (see encodeIterations())
+		unsigned long getNext() {return next == NEVER ? NEVER : nextTime();} // get Next
+		unsigned long getPeriod() {return decodePeriod(period);} // get Period
 		int getIterations() {return iterations;}					// return iterations
 		int getTaskCount() {return taskCount;}						// get task count
+#if SCHED_COMPACT
+		int getTaskID();													// 0, 1, ... in order of instantiation (derived from list position)
+		int getTaskID(int pos) {return taskCount - 1 - pos;}	// same, for a task 'pos' places from getFirstTask() (no list walk)
+#else
 		int getTaskID() {return taskID;}								// 0, 1, ... in order of instantiation
+		int getTaskID(int) {return taskID;}							// same; the position is only needed with SCHED_COMPACT
+#endif
+		static int getDispatchID() {return dispatchID;}			// ID of the task being dispatched, for hooks with wantsID (see above)
+		// The walk gives the tasks themselves, so their setters can be used (SchedSnapshot and SchedReplay do);
+		// don't construct or destroy tasks while walking.
+		static SchedBase* getFirstTask() {return tasksHead;}	// most recently constructed task, nullptr if none
+		SchedBase* getNextTask() {return taskLink;}				// the task constructed before this one, nullptr at the end
+#if SCHED_NAMES
+		void setName(const char* nm) {name = nm;}					// name the task (the string is not copied)
+		const char* getName() {return name ? name : "";}		// name of the task, "" if none
+#else
+		void setName(const char*) {}									// names are not kept unless SCHED_NAMES is set
+		const char* getName() {return "";}
+#endif
+#if SCHED_GROUPS
+		SchedGroup* getGroup() {return group;}						// group the task belongs to, nullptr if none
+		bool isSuspended() {return group && group->isSuspended();} // the task's group is suspended
+#else
+		bool isSuspended() {return false;}
+#endif
 		virtual void setFunc(pFunc) =0;								// set function
 		virtual pFunc getFunc() =0;									// get function
 
@@ -64,17 +144,140 @@ class SchedBase {
 		// only one copy of static members for the class, not one per object/instance
 		static SchedBase* tasksHead;									// head of linked list of tasks
 		static int taskCount;											// task taskCount
+		static int dispatchID;											// see getDispatchID()
+		static pClock clock;												// clock used by the dispatcher and setNext()
+		static void (*periodHook)(SchedBase*);						// called after setPeriod(), if set; one user only (SchedPhase)
+#if SCHED_RECORD
+		static void (*changeHook)(SchedBase*, int);				// called after setNext(), setPeriod() and setIterations(), if set
+		void changed(int id = -1) {if (changeHook) changeHook(this, id);} // with the task's ID, or -1 if not known
+#else
+		void changed(int = -1) {}
+#endif
+#if SCHED_ROTATE
+		static SchedBase* cursor;										// where the next dispatcher pass starts
+		static SchedBase* passStart;									// where the pass in progress stops (nullptr: at the next task)
+		static SchedBase* passNext;									// the next task the pass in progress visits
+#if SCHED_COMPACT
+		static int cursorID;												// getTaskID() of cursor, kept up to date so a pass needn't walk the list
+#endif
+#endif
 
 		SchedBase* taskLink;												// link to next task in list
 
-		unsigned long next;												// next
+		uint32_t next;														// next (32 bits even where unsigned long is wider, so it rolls over like millis())
+#if SCHED_COMPACT
+		uint16_t period;													// period, see encodePeriod()
+		int16_t iterations;												// iterations (-1 means not specified)
+#else
 		unsigned long period;											// period
 		int iterations;													// iterations (-1 means not specified)
 		int taskID;															// 0, 1, ... in order of instatiation
+#endif
+#if SCHED_NAMES
+		const char* name;													// set by setName()
+#endif
+#if SCHED_GROUPS
+		SchedGroup* group;												// set by SchedGroup::add()
+		unsigned long groupOffset() {return !group ? 0 : group->isSuspended() ? group->current() : group->getOffset();} // a member's 'next' is kept relative to its group
+#else
+		unsigned long groupOffset() {return 0;}
+#endif
+		unsigned long nextTime() {return (uint32_t)(next + groupOffset());} // 'next' on the clock (unless it's NEVER)
 
 		int addTask(SchedBase*);										// add another task to the linked list								
 		virtual void callFunc() =0;									// have the derived class call the task
 		virtual bool checkFunc() =0;									// whether func is non-NULL
+
+#if SCHED_COMPACT
+		// periods up to 32767 ms are stored as is; longer ones in seconds with the top bit set
+		static uint16_t encodePeriod(unsigned long per) {
+			if (per <= 0x7FFFUL) return per;
+			per = (per + 500) / 1000;									// nearest second
+			return 0x8000 | (per > 0x7FFFUL ? 0x7FFF : per);
+		}
+		static unsigned long decodePeriod(uint16_t per) {return (per & 0x8000) ? (per & 0x7FFFUL) * 1000UL : per;}
+		// iterations over 32767 are kept as 32767 and any negative count as -1 (not specified) rather than wrapping
+		static int16_t encodeIterations(long iter) {return iter > 0x7FFFL ? 0x7FFF : iter < 0 ? -1 : iter;}
+#else
+		static unsigned long encodePeriod(unsigned long per) {return per;}
+		static unsigned long decodePeriod(unsigned long per) {return per;}
+		static int encodeIterations(long iter) {return iter;}
+#endif
 };
 
+// Dispatcher
+template <class Hooks> void SchedBase::dispatcher() {			// dispatcher
+	bool dispatched = false;											// whether this pass called any task
+#if SCHED_ROTATE
+	SchedBase* first = cursor ? cursor : tasksHead;				// start where the last pass left off
+#if SCHED_COMPACT
+	int id = cursor ? cursorID : taskCount - 1;					// ID of first (only used when Hooks::wantsID)
+	cursorID = id - 1;												// the ID of the task after it
+#endif
+	if (first) cursor = first->taskLink;							// and start the next pass one task later
+	passStart = first;													// the destructor moves passStart and passNext on if their task goes
+	SchedBase* pTask = first;
+#else
+	SchedBase* pTask = tasksHead;										// point to the first task in the list
+#if SCHED_COMPACT
+	int id = taskCount - 1;												// the head is the last constructed (only used when Hooks::wantsID)
+#endif
+#endif
+	while (pTask) {														// loop thru the task linked list
+#if SCHED_ROTATE
+		passNext = pTask->taskLink ? pTask->taskLink : tasksHead;	// get link to the next task, wrapping around to the head
+#endif
+		if (!pTask->isSuspended() && pTask->checkFunc()) {		// only if its group is running and the function to call is valid
+			if (pTask->next != NEVER)  {								// do not dispatch if Next is NEVER
+				unsigned long now = clock();								// get the current time
+				if (pTask->iterations == 0) {							// iterations were specified and went to zero
+					pTask->next = NEVER;									// prevent future dispatches
+					pTask->iterations = -1;								// no more iterations
+#if SCHED_COMPACT
+					pTask->changed(SchedHookWantsID<Hooks>::value ? id : -1); // a recording must keep this pass (see SchedRecorder.h)
+#else
+					pTask->changed(pTask->taskID);						// a recording must keep this pass (see SchedRecorder.h)
+#endif
+				}																// done with this task, do not dispatch, but carry on with the others
+// proceed if iterations not specified or some remaining
+				else if ((int32_t)(pTask->nextTime() - now) <= 0) {		// time to run the next task in the array? (see https://arduino.stackexchange.com/questions/12587/how-can-i-handle-the-millis-rollover/12588#12588)
+					if (pTask->period == ONESHOT) {					// one-shot task?
+						pTask->next = NEVER;								// ensure it won't run again
+					}
+					else {													// periodic task
+						pTask->next = pTask->next + pTask->getPeriod(); // compute the next time to dispatch it (when it should have run + period)
+						if (pTask->next == NEVER) pTask->next++;		// the clock can legitimately read 0xFFFFFFFF; don't let that retire the task
+					}
+					if (pTask->iterations > 0) {						// iterations specified and some remaining
+						pTask->iterations--;								// decrement iterations remaining
+					}
+#if SCHED_COMPACT
+					if (SchedHookWantsID<Hooks>::value) dispatchID = id; // compiles to nothing for other hooks
+#else
+					if (SchedHookWantsID<Hooks>::value) dispatchID = pTask->taskID;
+#endif
+					Hooks::preDispatch(pTask);
+					pTask->callFunc();									// call the derived class function to dispatch the task
+					Hooks::postDispatch(pTask);
+					dispatched = true;
+				}
+			}
+		}
+#if SCHED_ROTATE
+		pTask = passNext;													// read after the dispatch: pTask may have destroyed itself
+		if (!passStart) passStart = pTask;							// the first task of the pass went while it was being dispatched
+		else if (pTask == passStart) break;							// every task visited
+#if SCHED_COMPACT
+		if (SchedHookWantsID<Hooks>::value) id = pTask == tasksHead ? taskCount - 1 : id - 1;
+#endif
+#else
+		pTask = pTask->taskLink;										// get link to the next task, if any
+#if SCHED_COMPACT
+		if (SchedHookWantsID<Hooks>::value) id--;
+#endif
+#endif
+	}
+	if (!dispatched) Hooks::idle();									// nothing was due this pass
+}
+
 #endif
@@ -0,0 +1,95 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedConfig.h - compile time options for the SchedTask library
+
+Each option may be changed here or defined by the build (e.g. build_flags = -DSCHED_COMPACT=1 in PlatformIO).
+The options change the layout of every task object, so the whole library and the sketch must be compiled with
+the same settings.  Editing this file is the simplest way to guarantee that in the Arduino IDE.
+
+Run Example_13 to print the size of each task type for the current settings.
+
+	Change log
+
+		2026-10-19 initial coding, SCHED_COMPACT
+		2026-10-19 SCHED_PROFILE_TASKS
+		2026-10-19 SCHED_ROTATE
+		2026-10-19 SCHED_PHASE_STEPS
+		2026-10-19 SCHED_ELASTIC_TASKS
+		2026-10-19 SCHED_BACKGROUND_JOBS
+		2026-10-19 SCHED_NAMES
+		2026-10-19 SCHED_GROUPS
+		2026-10-19 SCHED_CYCLIC_SLOTS
+		2026-10-19 SCHED_RECORD
+		2026-10-19 SCHED_COMPACT limits and savings spelled out
+*/
+
+#ifndef SchedConfig_h
+#define SchedConfig_h
+
+// SCHED_COMPACT 1 shrinks each task by storing less per task:
+//		- the period is kept in 16 bits: exact up to 32767 ms, longer periods are kept to the nearest second (up to 32767 sec)
+//		- iterations are kept in 16 bits on every platform: -1 (not specified) to 32767; larger counts given to
+//		  setIterations() or a constructor are kept as 32767 and other negative ones as -1
+//		- the task ID is not stored; getTaskID() derives it from the position in the task list, which takes a walk of
+//		  the list (O(n)); hooks can use getDispatchID() and loops over the tasks getTaskID(pos) instead
+//		- so the ID of a task changes when a task constructed before it is destroyed (the IDs stay 0 .. count-1)
+// The saving is the period's two bytes and the stored ID: on AVR a SchedBase goes from 16 to 12 bytes and a
+// SchedTask from 18 to 14, about a fifth; on 32 bit boards a SchedTask goes from 28 to 20.  Example_13 prints both layouts.
+#ifndef SCHED_COMPACT
+#define SCHED_COMPACT 0
+#endif
+
+// SCHED_ROTATE 1 makes the dispatcher fair among tasks that are due at the same time.  Normally every pass starts
+// with the most recently constructed task, so it always wins a tie.  With SCHED_ROTATE each pass starts one task
+// further along the list, so every task takes its turn at the front.
+#ifndef SCHED_ROTATE
+#define SCHED_ROTATE 0
+#endif
+
+// SCHED_PROFILE_TASKS is how many tasks SchedProfiler keeps timings for (by task ID, 8 bytes each)
+#ifndef SCHED_PROFILE_TASKS
+#define SCHED_PROFILE_TASKS 16
+#endif
+
+// SCHED_PHASE_STEPS is how many offsets within its period SchedPhase tries for each task (more is slower but finer)
+#ifndef SCHED_PHASE_STEPS
+#define SCHED_PHASE_STEPS 50
+#endif
+
+// SCHED_ELASTIC_TASKS is how many tasks SchedElastic can stretch (6 to 12 bytes each)
+#ifndef SCHED_ELASTIC_TASKS
+#define SCHED_ELASTIC_TASKS 8
+#endif
+
+// SCHED_BACKGROUND_JOBS is how many jobs SchedBackground can hold at once (4 to 8 bytes each)
+#ifndef SCHED_BACKGROUND_JOBS
+#define SCHED_BACKGROUND_JOBS 4
+#endif
+
+// SCHED_NAMES 1 keeps a name for each task (one pointer per task) for setName()/getName() and SchedTelemetry
+#ifndef SCHED_NAMES
+#define SCHED_NAMES 0
+#endif
+
+// SCHED_GROUPS 1 lets tasks join a SchedGroup (one pointer per task) so a whole group can be suspended, resumed
+// or shifted in time at once
+#ifndef SCHED_GROUPS
+#define SCHED_GROUPS 0
+#endif
+
+// SCHED_CYCLIC_SLOTS is the most minor frames a SchedCyclic table may hold (hyperperiod / minor frame)
+#ifndef SCHED_CYCLIC_SLOTS
+#define SCHED_CYCLIC_SLOTS 1024
+#endif
+
+// SCHED_RECORD 1 has setNext(), setPeriod() and setIterations() report changes to SchedRecorder (one test per call)
+#ifndef SCHED_RECORD
+#define SCHED_RECORD 0
+#endif
+
+#endif
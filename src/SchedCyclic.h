@@ -0,0 +1,182 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedCyclic.h - a cyclic executive whose schedule is worked out when compiling
+
+When the periodic work of a sketch is fixed at build time there is no need to look at each task to see if it is
+due.  SchedCyclic takes a list of entries (function, period, offset and, optionally, worst case time), works out
+the hyperperiod (the least common multiple of the periods) and builds a table with one entry per minor frame
+saying which functions run in that frame.  At run time it is a single task dispatched once per minor frame,
+which calls the functions listed for the frame.  Ordinary SchedTask objects carry on alongside it.
+
+Syntax:
+
+	void readSensors();													// functions take no parameters
+	void control();
+	void report();
+
+	SchedCyclic<10,														// minor frame in ms; 0 works it out (gcd of the periods and offsets)
+		SchedEntry<readSensors, 10>,									// every 10 ms
+		SchedEntry<control, 20, 0, 3000>,							// every 20 ms, takes at most 3000 us
+		SchedEntry<report, 100, 50, 2000>							// every 100 ms, 50 ms into the period, at most 2000 us
+	> Executive;															// starts NOW; Executive(next) starts at 'next' like a SchedTask
+
+Within a frame the functions are called in the order of the entries.  The set is checked when compiling: every
+period and offset must be a multiple of the minor frame, offsets must be less than their period, the table must
+fit in SCHED_CYCLIC_SLOTS frames, and the worst case times of the functions in any one frame must add up to no
+more than the frame.  A set that fails any of these does not compile.  Up to 32 entries; the table takes 1, 2
+or 4 bytes per frame (8, 16 or 32 entries), in flash where the board supports PROGMEM.
+
+If the Dispatcher is late the frames missed are run back to back, so no entry is skipped.
+
+	Change log
+
+		2026-10-19 initial coding
+*/
+
+#ifndef SchedCyclic_h
+#define SchedCyclic_h
+
+#include <SchedBase.h>
+
+// an entry: function, period (ms), offset into the period (ms) and worst case execution time (us, 0 if unknown)
+template <void (*F)(), unsigned long P, unsigned long O = 0, unsigned long C = 0>
+struct SchedEntry {
+	typedef void (*pFunc)();
+	static constexpr pFunc func() {return F;}
+	static constexpr unsigned long period() {return P;}
+	static constexpr unsigned long offset() {return O;}
+	static constexpr unsigned long cost() {return C;}
+};
+
+// compile time helpers for SchedCyclic
+namespace SchedCyclicDetail {
+
+	constexpr unsigned long gcd(unsigned long a, unsigned long b) {return b ? gcd(b, a % b) : a;}
+	constexpr unsigned long lcm(unsigned long a, unsigned long b) {return a / gcd(a, b) * b;}
+	constexpr unsigned long max(unsigned long a, unsigned long b) {return a > b ? a : b;}
+
+	template <class... E> struct Set;									// properties of a list of entries
+
+	template <> struct Set<> {
+		static constexpr unsigned long hyper() {return 1;}
+		static constexpr unsigned long frame() {return 0;}
+		static constexpr bool aligned(unsigned long) {return true;}
+		static constexpr bool inPeriod() {return true;}
+		static constexpr unsigned long mask(unsigned long, int) {return 0;}
+		static constexpr unsigned long load(unsigned long) {return 0;}
+	};
+
+	template <class E, class... R> struct Set<E, R...> {
+		static constexpr unsigned long hyper() {return lcm(E::period(), Set<R...>::hyper());}
+		static constexpr unsigned long frame() {return gcd(gcd(E::period(), E::offset()), Set<R...>::frame());}
+		static constexpr bool aligned(unsigned long f) {return E::period() % f == 0 && E::offset() % f == 0 && Set<R...>::aligned(f);}
+		static constexpr bool inPeriod() {return E::period() > 0 && E::offset() < E::period() && Set<R...>::inPeriod();}
+		static constexpr bool due(unsigned long t) {return t % E::period() == E::offset();}
+		// bit 'bit' onwards: the entries due at time t into the hyperperiod
+		static constexpr unsigned long mask(unsigned long t, int bit) {return (due(t) ? 1UL << bit : 0) | Set<R...>::mask(t, bit + 1);}
+		// us of work due at time t
+		static constexpr unsigned long load(unsigned long t) {return (due(t) ? E::cost() : 0) + Set<R...>::load(t);}
+	};
+
+	// heaviest frame in [lo, hi), halving the range so the recursion stays shallow
+	template <class S> constexpr unsigned long peak(unsigned long frame, unsigned long lo, unsigned long hi) {
+		return hi - lo == 1 ? S::load(lo * frame) : max(peak<S>(frame, lo, lo + (hi - lo) / 2), peak<S>(frame, lo + (hi - lo) / 2, hi));
+	}
+
+	template <unsigned... I> struct Seq {typedef Seq type;};		// 0, 1, ... N-1 for building the table
+	template <class A, class B> struct Cat;
+	template <unsigned... A, unsigned... B> struct Cat<Seq<A...>, Seq<B...> > {typedef Seq<A..., (sizeof...(A) + B)...> type;};
+	template <unsigned N> struct MakeSeq : Cat<typename MakeSeq<N / 2>::type, typename MakeSeq<N - N / 2>::type> {};
+	template <> struct MakeSeq<0> {typedef Seq<> type;};
+	template <> struct MakeSeq<1> {typedef Seq<0> type;};
+
+	template <int N> struct MaskType {typedef uint32_t type;};	// smallest type with a bit per entry
+	template <> struct MaskType<8> {typedef uint8_t type;};
+	template <> struct MaskType<16> {typedef uint16_t type;};
+
+	template <class S, unsigned long F, class M, class Q> struct Table;
+	template <class S, unsigned long F, class M, unsigned... I> struct Table<S, F, M, Seq<I...> > {
+		static const M slots[sizeof...(I)];							// entries due in each frame
+	};
+#ifdef PROGMEM
+	template <class S, unsigned long F, class M, unsigned... I>
+	const M Table<S, F, M, Seq<I...> >::slots[sizeof...(I)] PROGMEM = {(M)S::mask(I * F, 0)...};
+#else
+	template <class S, unsigned long F, class M, unsigned... I>
+	const M Table<S, F, M, Seq<I...> >::slots[sizeof...(I)] = {(M)S::mask(I * F, 0)...};
+#endif
+}
+
+template <unsigned long Frame, class... Entries>
+class SchedCyclic : public SchedBase {
+	typedef void (*pFunc)();
+	typedef SchedCyclicDetail::Set<Entries...> Set;
+
+	static_assert(sizeof...(Entries) > 0 && sizeof...(Entries) <= 32, "SchedCyclic takes 1 to 32 entries");
+	static_assert(Set::inPeriod(), "SchedCyclic: every period must be > 0 and every offset less than its period");
+
+	public:
+		static constexpr unsigned long FRAME = Frame ? Frame : Set::frame();	// minor frame, ms
+		static constexpr unsigned long HYPERPERIOD = Set::hyper();			// ms before the table repeats
+		static constexpr unsigned long SLOTS = HYPERPERIOD / FRAME;			// frames in the table
+
+	private:
+		static_assert(Set::aligned(FRAME), "SchedCyclic: every period and offset must be a multiple of the minor frame");
+		static_assert(SLOTS <= SCHED_CYCLIC_SLOTS, "SchedCyclic: hyperperiod too long for SCHED_CYCLIC_SLOTS frames");
+
+		typedef typename SchedCyclicDetail::MaskType<(sizeof...(Entries) <= 8 ? 8 : sizeof...(Entries) <= 16 ? 16 : 32)>::type Mask;
+		static constexpr unsigned long TABLE = SLOTS <= SCHED_CYCLIC_SLOTS ? SLOTS : 1;	// don't build an oversized table before the assert stops it
+		typedef SchedCyclicDetail::Table<Set, FRAME, Mask, typename SchedCyclicDetail::MakeSeq<TABLE>::type> Table;
+
+	public:
+		static constexpr unsigned long PEAK = SchedCyclicDetail::peak<Set>(FRAME, 0, TABLE);	// us of work in the heaviest frame
+
+	private:
+		static_assert(PEAK <= FRAME * 1000UL, "SchedCyclic: the entries due in one frame take longer than the frame");
+
+	public:
+		SchedCyclic(unsigned long next = NOW) : SchedBase(next, FRAME), slot(0) {}	// first frame at 'next', like a SchedTask
+
+		unsigned int getSlot() {return slot;}						// frame to be dispatched next, 0 to SLOTS-1
+		void restart() {slot = 0;}										// back to the start of the table at the next frame
+
+	private:
+
+		unsigned int slot;												// position in the table
+
+		void setFunc(pFunc) {;} 										// overrides pure virtual in base so this class not abstract
+		pFunc getFunc() {return nullptr;}							// overrides pure virtual in base so this class not abstract
+
+		virtual void callFunc();										// run the entries due in this frame
+		virtual bool checkFunc() {return true;}
+};
+
+template <unsigned long Frame, class... Entries> constexpr unsigned long SchedCyclic<Frame, Entries...>::FRAME;
+template <unsigned long Frame, class... Entries> constexpr unsigned long SchedCyclic<Frame, Entries...>::HYPERPERIOD;
+template <unsigned long Frame, class... Entries> constexpr unsigned long SchedCyclic<Frame, Entries...>::SLOTS;
+template <unsigned long Frame, class... Entries> constexpr unsigned long SchedCyclic<Frame, Entries...>::PEAK;
+
+template <unsigned long Frame, class... Entries>
+void SchedCyclic<Frame, Entries...>::callFunc() {
+	static const pFunc funcs[sizeof...(Entries)] = {Entries::func()...};
+	Mask due;
+#ifdef PROGMEM
+	due = 0;
+	for (unsigned int b=0; b<sizeof(Mask); b++) {					// read it back from flash a byte at a time
+		due |= (Mask)pgm_read_byte((const uint8_t*)&Table::slots[slot] + b) << (8 * b);
+	}
+#else
+	due = Table::slots[slot];
+#endif
+	if (++slot == SLOTS) slot = 0;
+	for (int i=0; due; i++, due >>= 1) {
+		if (due & 1) funcs[i]();
+	}
+}
+
+#endif
@@ -0,0 +1,35 @@
+/*
+	SchedDuty.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+*/
+
+#include <SchedDuty.h>
+
+// constructor definitions; the first edge starts the on phase, so the period in effect is the on time
+SchedDuty::SchedDuty (unsigned long nxt, unsigned long on, unsigned long off, pFuncP fnc)
+	: SchedBase(nxt, on), func(fnc), onTime(encodePeriod(on)), offTime(encodePeriod(off)), nextOn(true) {}
+SchedDuty::SchedDuty (unsigned long nxt, unsigned long on, unsigned long off, long cycles, pFuncP fnc)
+	: SchedBase(nxt, on, cycles * 2), func(fnc), onTime(encodePeriod(on)), offTime(encodePeriod(off)), nextOn(true) {}
+SchedDuty::~SchedDuty() {;}												// destructor
+
+// callFunc() - the dispatcher has already moved 'next' on by the period, i.e. the length of the phase now starting
+void SchedDuty::callFunc() {
+	bool on = nextOn;
+	nextOn = !on;
+	period = nextOn ? onTime : offTime;								// length of the phase the next edge starts
+	func(on);
+}
+// setTimes()
+void SchedDuty::setTimes(unsigned long on, unsigned long off) {
+	onTime = encodePeriod(on);
+	offTime = encodePeriod(off);
+	period = nextOn ? onTime : offTime;
+}
+// setPhase()
+void SchedDuty::setPhase(bool on) {
+	nextOn = on;
+	period = nextOn ? onTime : offTime;
+}
@@ -0,0 +1,78 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedDuty.h - one task for an on/off waveform with different on and off times
+
+Blinking with an on time different from the off time used to take two tasks (one to turn on, one to turn off, as
+in Example 11) or a task that changed its own next on every edge.  A SchedDuty does it with one task: the function
+is called with true at the start of each on time and false at the start of each off time.
+
+Syntax:
+
+SchedDuty TaskName (next, onTime, offTime, {cycles,} function);	// cycles is optional
+	where:
+		'next' is when the first on time starts (as for SchedTask)
+		'onTime' and 'offTime' are how long each phase lasts (in milliseconds, > 0)
+		'cycles', if specified, is how many on/off cycles to run; the task stops after the last off edge
+		'function' takes the phase being entered: void function(bool on) {...}
+
+Each edge is timed from when the previous one was due, not from when it was dispatched, so the waveform does not
+drift.  getPeriod() returns the length of the phase the next edge starts (the dispatcher adds it to 'next' at
+that edge); getPhaseLength() returns the length of the phase in progress.  Change the times with setTimes() rather
+than setPeriod().  setCycles() sets the cycles still to run (as setIterations() does for a SchedTask).
+
+	Change log
+
+		2026-10-19 initial coding
+		2026-10-19 getPhaseLength(); getPeriod() documented as the length of the next phase
+*/
+
+#ifndef SchedDuty_h
+#define SchedDuty_h
+
+#include <SchedBase.h>
+
+class SchedDuty : public SchedBase {
+	typedef void (*pFunc)();			// pFunc is of Type pointer to a function that takes no argument and returns void
+	typedef void (*pFuncP)(bool);		// pFuncP is of Type pointer to a function that takes the phase (true for on) and returns void
+
+	public:
+
+		SchedDuty(unsigned long next, unsigned long onTime, unsigned long offTime, pFuncP pFnc); // constructor declaration
+		SchedDuty(unsigned long next, unsigned long onTime, unsigned long offTime, long cycles, pFuncP pFnc); // constructor with cycles
+		~SchedDuty();																				// destructor
+
+		void setTimes(unsigned long onTime, unsigned long offTime);						// new on and off times, from the next edge
+		unsigned long getOnTime() {return decodePeriod(onTime);}
+		unsigned long getOffTime() {return decodePeriod(offTime);}
+		void setCycles(long cycles) {setIterations(cycles * 2);}							// on/off cycles to run
+		void setPhase(bool on);																	// which phase the next edge starts
+		bool isOn() {return !nextOn;}															// whether the on phase is in progress (or was the last entered)
+		unsigned long getPhaseLength() {return decodePeriod(nextOn ? offTime : onTime);} // length of the phase in progress (off before the first edge)
+		void setFuncP(pFuncP pF) {func = pF;}													// set new function pointer
+		pFuncP getFuncP() {return func;}														// return function pointer
+
+	private:
+
+		pFuncP func;																				// the function to call on each edge
+#if SCHED_COMPACT
+		uint16_t onTime;																			// phase lengths, encoded as 'period'
+		uint16_t offTime;
+#else
+		unsigned long onTime;																	// phase lengths
+		unsigned long offTime;
+#endif
+		bool nextOn;																				// phase the next edge starts
+
+		void setFunc(pFunc) {;} 																// overrides pure virtual in base so this class not abstract
+		pFunc getFunc() {return nullptr;}													// overrides pure virtual in base so this class not abstract
+
+		virtual void callFunc();																// call the function for this edge and set up the next
+		virtual bool checkFunc() {return func != NULL;}									// whether func contains non-NULL
+};
+
+#endif
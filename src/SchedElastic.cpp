@@ -0,0 +1,97 @@
+/*
+	SchedElastic.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 lateness taken in 32 bits
+*/
+
+#include <SchedElastic.h>
+
+const unsigned long WINDOW = 250000UL;								// us over which the load is measured
+const uint8_t STEP_UP = 64;											// level change per window when overloaded
+const uint8_t STEP_DOWN = 16;											// and when relaxed
+
+SchedElastic::Range SchedElastic::ranges[SCHED_ELASTIC_TASKS];
+uint8_t SchedElastic::level = 0;
+uint8_t SchedElastic::utilization = 0;
+uint8_t SchedElastic::high = 80;
+uint8_t SchedElastic::low = 50;
+unsigned long SchedElastic::lateLimit = 0;
+unsigned long SchedElastic::maxLate = 0;
+unsigned long SchedElastic::windowStart = 0;
+unsigned long SchedElastic::busy = 0;
+unsigned long SchedElastic::callStart = 0;
+
+// add()
+bool SchedElastic::add(SchedBase& task, unsigned long minPeriod, unsigned long maxPeriod) {
+	Range* free = nullptr;
+	for (int i=0; i<SCHED_ELASTIC_TASKS; i++) {
+		if (ranges[i].task == &task) free = &ranges[i];		// already elastic, just update the range
+		else if (!ranges[i].task && !free) free = &ranges[i];
+	}
+	if (!free) return false;
+	free->task = &task;
+	free->minPeriod = minPeriod;
+	free->maxPeriod = maxPeriod < minPeriod ? minPeriod : maxPeriod;
+	apply();
+	return true;
+}
+// remove()
+void SchedElastic::remove(SchedBase& task) {
+	for (int i=0; i<SCHED_ELASTIC_TASKS; i++) {
+		if (ranges[i].task == &task) ranges[i].task = nullptr;
+	}
+}
+// setThresholds()
+void SchedElastic::setThresholds(uint8_t hi, uint8_t lo, unsigned long late) {
+	high = hi;
+	low = lo;
+	lateLimit = late;
+}
+// setLoad()
+void SchedElastic::setLoad(uint8_t percent) {
+	utilization = percent;
+	adjust(percent > high, percent < low);
+}
+// preDispatch()
+void SchedElastic::preDispatch(SchedBase* task) {
+	if (lateLimit && task->getPeriod() != ONESHOT) {			// 'next' has already moved on one period
+		unsigned long late = (uint32_t)(SchedBase::getTime() - (task->getNext() - task->getPeriod()));
+		if (late > maxLate) maxLate = late;
+	}
+	callStart = micros();
+}
+// postDispatch()
+void SchedElastic::postDispatch(SchedBase*) {
+	busy += micros() - callStart;
+	tick();
+}
+// tick()
+void SchedElastic::tick() {
+	unsigned long elapsed = micros() - windowStart;
+	if (elapsed < WINDOW) return;
+	utilization = busy >= elapsed ? 100 : busy / (elapsed / 100);
+	bool late = lateLimit && maxLate > lateLimit;
+	adjust(utilization > high || late, utilization < low && !late);
+	windowStart += elapsed;
+	busy = 0;
+	maxLate = 0;
+}
+// adjust()
+void SchedElastic::adjust(bool overloaded, bool relaxed) {
+	if (overloaded) level = level > 255 - STEP_UP ? 255 : level + STEP_UP;
+	else if (relaxed) level = level < STEP_DOWN ? 0 : level - STEP_DOWN;
+	else return;															// in between: hold
+	apply();
+}
+// apply()
+void SchedElastic::apply() {
+	for (int i=0; i<SCHED_ELASTIC_TASKS; i++) {
+		Range& r = ranges[i];
+		if (!r.task) continue;
+		unsigned long period = r.minPeriod + (unsigned long)((r.maxPeriod - r.minPeriod) * (float)level / 255);
+		if (r.task->getPeriod() != period) r.task->setPeriod(period);
+	}
+}
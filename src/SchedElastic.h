@@ -0,0 +1,85 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedElastic.h - stretches the period of low value tasks when the sketch is overloaded
+
+When there is more work than time every task slips, the important ones as much as a status LED.  With
+SchedElastic, tasks that can run less often declare a period range.  While the dispatcher is overloaded their
+periods are stretched toward the maximum, and as the load drops they return to the minimum.  Other tasks keep
+their periods.  getPeriod() always returns the period currently in effect.
+
+	SchedElastic::add(StatusTask, 100, 1000);					// in setup(): every 100 ms normally, down to every 1 s
+
+	void loop() {
+		SchedBase::dispatcher<SchedElastic>();					// SchedElastic measures the load as dispatch hooks
+	}
+
+The load is measured over a window of 250 ms as the fraction of time spent in dispatched functions.  Optionally
+the lateness of periodic tasks (how long after 'next' they were dispatched) also counts as overload.  After each
+window:
+
+	utilization above the high threshold, or lateness above the limit:	stretch (quickly)
+	utilization below the low threshold and lateness within the limit:	restore (slowly)
+
+All elastic tasks are stretched together by the same fraction of their range (getLevel(), 0 to 255).
+
+	SchedElastic::setThresholds(80, 50);						// high and low utilization in percent (the defaults)
+	SchedElastic::setThresholds(80, 50, 20);					// and treat lateness over 20 ms as overload
+
+The load can also be supplied by the sketch instead of measured; call setLoad() (0 to 100 percent) instead of
+using the hooks.  To use SchedElastic together with other hooks see SchedHookChain in SchedBase.h.
+
+Up to SCHED_ELASTIC_TASKS tasks can be elastic (see SchedConfig.h).
+
+	Change log
+
+		2026-10-19 initial coding
+*/
+
+#ifndef SchedElastic_h
+#define SchedElastic_h
+
+#include <SchedBase.h>
+
+class SchedElastic {
+	public:
+
+		static bool add(SchedBase& task, unsigned long minPeriod, unsigned long maxPeriod); // false if the table is full
+		static void remove(SchedBase& task);						// back to a fixed period (its current one)
+		static void setThresholds(uint8_t high, uint8_t low, unsigned long lateLimit = 0); // percent, percent, ms (0 = ignore lateness)
+		static void setLoad(uint8_t percent);						// supply the load instead of measuring it
+		static uint8_t getLevel() {return level;}					// 0 = minimum periods ... 255 = maximum periods
+		static uint8_t getUtilization() {return utilization;}	// percent, last window
+
+		static void preDispatch(SchedBase* task);					// dispatch hooks
+		static void postDispatch(SchedBase*);
+		static void idle() {tick();}
+
+	private:
+
+		struct Range {
+			SchedBase* task;
+			unsigned long minPeriod;
+			unsigned long maxPeriod;
+		};
+		static Range ranges[SCHED_ELASTIC_TASKS];				// elastic tasks (task is nullptr when unused)
+		static uint8_t level;											// current stretch
+		static uint8_t utilization;									// percent, last window
+		static uint8_t high;												// thresholds
+		static uint8_t low;
+		static unsigned long lateLimit;								// ms, 0 = lateness not used
+		static unsigned long maxLate;									// worst lateness this window
+		static unsigned long windowStart;							// micros() at the start of the window
+		static unsigned long busy;										// us spent in dispatched functions this window
+		static unsigned long callStart;								// micros() when the current function was called
+
+		static void tick();												// end the window when it's time
+		static void adjust(bool overloaded, bool relaxed);		// move the level and apply it
+		static void apply();												// set the period of every elastic task from the level
+};
+
+#endif
@@ -0,0 +1,64 @@
+/*
+	SchedGroup.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 add() and remove() allow for a suspension in progress
+		2026-10-19 current() public, for a member's setNext() and getNext()
+*/
+
+#include <SchedBase.h>
+
+#if SCHED_GROUPS
+
+// constructor
+SchedGroup::SchedGroup(const char* nm) : offset(0), since(0), suspended(false), name(nm) {
+}
+// destructor
+SchedGroup::~SchedGroup() {
+	for (SchedBase* pTask = SchedBase::getFirstTask(); pTask; pTask = pTask->getNextTask()) {
+		remove(*pTask);
+	}
+}
+// add()
+void SchedGroup::add(SchedBase& task) {
+	if (task.group == this) return;
+	if (task.group) task.group->remove(task);
+	if (task.next != NEVER) {
+		task.next -= current();											// same time on the clock, relative to the group
+		if (task.next == NEVER) task.next++;
+	}
+	task.group = this;
+}
+// remove()
+void SchedGroup::remove(SchedBase& task) {
+	if (task.group != this) return;
+	if (task.next != NEVER) {
+		task.next += current();											// back to clock time, less any suspension so far
+		if (task.next == NEVER) task.next++;
+	}
+	task.group = nullptr;
+}
+// current() - the offset as it would be if the group were resumed now
+unsigned long SchedGroup::current() {
+	return suspended ? offset + (SchedBase::getTime() - since) : offset;
+}
+// suspend()
+void SchedGroup::suspend() {
+	if (suspended) return;
+	since = SchedBase::getTime();
+	suspended = true;
+}
+// resume()
+void SchedGroup::resume() {
+	if (!suspended) return;
+	offset += SchedBase::getTime() - since;						// the members lose the time they were suspended
+	suspended = false;
+}
+// shift()
+void SchedGroup::shift(signed long ms) {
+	offset += ms;
+}
+
+#endif
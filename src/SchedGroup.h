@@ -0,0 +1,75 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedGroup.h - suspend, resume and shift a group of tasks at once
+
+Requires SCHED_GROUPS 1 in SchedConfig.h (or in the build flags).
+
+	SchedGroup Motors;													// defined before setup()
+
+	Motors.add(LeftTask);												// in setup()
+	Motors.add(RightTask);
+
+	Motors.suspend();														// none of the members is dispatched
+	Motors.resume();														// each member is due as long after the resume as it was after the suspend
+	Motors.shift(250);													// every member 250 ms later (negative for earlier)
+
+The 'next' of a member is kept relative to an offset held by the group, so suspend(), resume() and shift() change
+only the group, however many members it has, and the members keep their phase to one another.  A member of a
+suspended group is still visited by the dispatcher, which passes over it with a single test (the same cost as a
+task at NEVER), so suspending a group saves the dispatches but not the walk of the list.  getNext() and setNext()
+on a member work in clock time as usual; while the group is suspended they work as if it were resumed now, so a
+member set to be due in 100 ms is due 100 ms after the resume, and getNext() moves on with the clock.
+
+A task is in one group at most; adding it to another takes it out of the first.  A task added to a group keeps
+its 'next'; added to a suspended group it stands still from then until the resume.  A task removed from a
+suspended group (or from a group being destroyed) carries on as if the group had been resumed first.
+
+	Change log
+
+		2026-10-19 initial coding
+		2026-10-19 add() and remove() allow for a suspension in progress
+		2026-10-19 setNext() and getNext() on a member allow for a suspension in progress (current())
+*/
+
+#ifndef SchedGroup_h
+#define SchedGroup_h
+
+#include <Arduino.h>
+#include <SchedConfig.h>
+
+#if !SCHED_GROUPS
+#error "SchedGroup needs SCHED_GROUPS set to 1 in SchedConfig.h or the build flags"
+#endif
+
+class SchedBase;
+
+class SchedGroup {
+	public:
+
+		SchedGroup(const char* nm = nullptr);						// constructor; the name is for the sketch's use
+		~SchedGroup();														// takes the members out of the group
+
+		void add(SchedBase& task);										// make the task a member
+		void remove(SchedBase& task);									// take the task out of the group
+		void suspend();													// stop dispatching the members
+		void resume();														// carry on from where the members were
+		void shift(signed long ms);									// move every member later (or earlier)
+		bool isSuspended() {return suspended;}
+		unsigned long getOffset() {return offset;}				// added to the 'next' of each member
+		unsigned long current();										// offset including a suspension in progress
+		const char* getName() {return name ? name : "";}
+
+	private:
+
+		unsigned long offset;											// ms the members have been moved by
+		unsigned long since;												// clock when suspended
+		bool suspended;
+		const char* name;
+};
+
+#endif
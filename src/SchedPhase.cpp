@@ -0,0 +1,183 @@
+/*
+	SchedPhase.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 group members are placed in clock time; suspended ones are left alone
+		2026-10-19 costs looked up once per task per walk of the list, not in every comparison
+		2026-10-19 times compared in 32 bits
+		2026-10-19 periodChanged() notes the task; replan() places it
+*/
+
+#include <SchedPhase.h>
+
+SchedBase* SchedPhase::pending = nullptr;
+bool SchedPhase::several = false;
+
+const unsigned long MAX_FIRINGS = 256;								// look no further than this many periods of a task
+
+// active()
+bool SchedPhase::active(SchedBase* task) {
+	return !task->isSuspended() && task->checkFunc() && task->next != NEVER && task->period != ONESHOT;
+}
+// cost()
+unsigned long SchedPhase::cost(SchedBase* task) {
+	unsigned long wcet = SchedProfiler::getWcet(task->getTaskID());
+	return wcet ? wcet : 1;
+}
+unsigned long SchedPhase::cost(SchedBase* task, int pos) {	// while walking the list: no getTaskID() walk with SCHED_COMPACT
+	unsigned long wcet = SchedProfiler::getWcet(task->getTaskID(pos));
+	return wcet ? wcet : 1;
+}
+// before()
+bool SchedPhase::before(SchedBase* a, unsigned long ca, SchedBase* b, unsigned long cb) { // a strict total order, so plan() needs no marks
+	if (ca != cb) return ca > cb;
+	if (a->getPeriod() != b->getPeriod()) return a->getPeriod() < b->getPeriod();
+	return a < b;
+}
+// gcd()
+unsigned long SchedPhase::gcd(unsigned long a, unsigned long b) {
+	while (b) {
+		unsigned long t = a % b;
+		a = b;
+		b = t;
+	}
+	return a;
+}
+// hyperperiod()
+unsigned long SchedPhase::hyperperiod() {
+	const unsigned long LIMIT = 0x3FFFFFFFUL;						// well inside the signed range the dispatcher compares
+	unsigned long h = 1;
+	for (SchedBase* pTask = SchedBase::tasksHead; pTask; pTask = pTask->taskLink) {
+		if (!active(pTask)) continue;
+		unsigned long p = pTask->getPeriod();
+		unsigned long f = p / gcd(h, p);								// factor the hyperperiod grows by
+		h = (h > LIMIT / f) ? LIMIT : h * f;
+	}
+	return h;
+}
+// phase()
+unsigned long SchedPhase::phase(SchedBase* task, unsigned long base) {
+	signed long p = task->getPeriod();
+	signed long rel = (int32_t)(task->nextTime() - base);		// may be in the past (overdue)
+	return ((rel % p) + p) % p;
+}
+// loadAt() - cost of the tasks due at base + t, leaving out 'skip' and (if 'upto' is set) tasks not placed before it
+unsigned long SchedPhase::loadAt(unsigned long t, unsigned long base, SchedBase* skip, SchedBase* upto, unsigned long uptoCost) {
+	unsigned long load = 0;
+	int pos = 0;
+	for (SchedBase* pTask = SchedBase::tasksHead; pTask; pTask = pTask->taskLink, pos++) {
+		if (pTask == skip || !active(pTask)) continue;
+		unsigned long c = cost(pTask, pos);
+		if (upto && !before(pTask, c, upto, uptoCost)) continue;
+		if ((t + pTask->getPeriod() - phase(pTask, base)) % pTask->getPeriod() == 0) load += c;
+	}
+	return load;
+}
+// placeTask()
+void SchedPhase::placeTask(SchedBase* task, unsigned long c, unsigned long base, SchedBase* upto) {
+	unsigned long p = task->getPeriod();
+	unsigned long uptoCost = upto == task ? c : upto ? cost(upto) : 0;
+	unsigned long span = hyperperiod();
+	if (span / p > MAX_FIRINGS) span = p * MAX_FIRINGS;
+	unsigned long step = p / SCHED_PHASE_STEPS;
+	if (step == 0) step = 1;
+
+	unsigned long best = 0;
+	unsigned long bestPeak = 0xFFFFFFFFUL;
+	unsigned long bestSum = 0xFFFFFFFFUL;
+	for (unsigned long o = 0; o < p; o += step) {				// each candidate offset within the period
+		unsigned long peak = 0;
+		unsigned long sum = 0;
+		for (unsigned long t = o; t < span; t += p) {			// every time the task would fall due
+			unsigned long load = loadAt(t, base, task, upto, uptoCost) + c;
+			if (load > peak) peak = load;
+			sum += load;
+		}
+		if (peak < bestPeak || (peak == bestPeak && sum < bestSum)) {
+			best = o;
+			bestPeak = peak;
+			bestSum = sum;
+		}
+	}
+
+	unsigned long target = base + best;
+	signed long d = (int32_t)(task->nextTime() - target);
+	if (d > 0) target += ((d + p - 1) / p) * p;					// never earlier than the task's current next
+	target -= task->groupOffset();									// a group member's next is relative to its group
+	if (target == NEVER) target++;
+	task->next = target;
+}
+// plan()
+void SchedPhase::plan() {
+	unsigned long base = SchedBase::getTime();
+	SchedBase* last = nullptr;
+	unsigned long lastCost = 0;
+	for (;;) {
+		SchedBase* pick = nullptr;										// next task to place
+		unsigned long pickCost = 0;
+		int pos = 0;
+		for (SchedBase* pTask = SchedBase::tasksHead; pTask; pTask = pTask->taskLink, pos++) {
+			if (!active(pTask)) continue;
+			unsigned long c = cost(pTask, pos);
+			if ((!last || before(last, lastCost, pTask, c)) && (!pick || before(pTask, c, pick, pickCost))) {
+				pick = pTask;
+				pickCost = c;
+			}
+		}
+		if (!pick) break;													// all placed
+		placeTask(pick, pickCost, base, pick);						// against the tasks placed so far
+		last = pick;
+		lastCost = pickCost;
+	}
+}
+// place()
+void SchedPhase::place(SchedBase& task) {
+	if (active(&task)) placeTask(&task, cost(&task), SchedBase::getTime(), nullptr); // against all the others
+}
+// setAuto()
+void SchedPhase::setAuto(bool on) {
+	if (on) SchedBase::periodHook = periodChanged;				// the only period hook (see SchedPhase.h)
+	else if (SchedBase::periodHook == periodChanged) SchedBase::periodHook = nullptr;
+	pending = nullptr;
+	several = false;
+}
+// periodChanged() - from setPeriod(), maybe in a dispatched function; just note the task
+void SchedPhase::periodChanged(SchedBase* task) {
+	if (pending && pending != task) several = true;
+	pending = task;
+}
+// replan()
+void SchedPhase::replan() {
+	if (!pending) return;
+	if (several) {
+		plan();
+	}
+	else {
+		for (SchedBase* pTask = SchedBase::tasksHead; pTask; pTask = pTask->taskLink) {
+			if (pTask == pending) {										// still there
+				place(*pTask);
+				break;
+			}
+		}
+	}
+	pending = nullptr;
+	several = false;
+}
+// peak()
+unsigned long SchedPhase::peak() {
+	unsigned long base = SchedBase::getTime();
+	unsigned long span = hyperperiod();
+	unsigned long most = 0;
+	for (SchedBase* pTask = SchedBase::tasksHead; pTask; pTask = pTask->taskLink) {
+		if (!active(pTask)) continue;									// the busiest moment is when some task is due
+		unsigned long p = pTask->getPeriod();
+		unsigned long end = (span / p > MAX_FIRINGS) ? p * MAX_FIRINGS : span;
+		for (unsigned long t = phase(pTask, base); t < end; t += p) {
+			unsigned long load = loadAt(t, base, nullptr, nullptr, 0);
+			if (load > most) most = load;
+		}
+	}
+	return most;
+}
@@ -0,0 +1,79 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedPhase.h - staggers periodic tasks so they don't all fall due at once
+
+Ten tasks constructed with 'next' NOW and periods of 100, 200 and 500 ms all line up every second, and that one
+pass of the dispatcher then runs all ten.  SchedPhase shifts the 'next' of each periodic task within its period
+so that the work falling due in any one millisecond is as small as possible over the hyperperiod (the time after
+which the pattern repeats).
+
+	SchedPhase::plan();												// in setup(), once the tasks are defined
+	SchedPhase::setAuto(true);										// optional: re-place a task after setPeriod() changes it
+	SchedBase::dispatcher<SchedPhase>();						// in loop(): the re-placing is done when a pass is idle
+
+Tasks are placed one at a time, most costly first, each at the offset that keeps the busiest millisecond as light
+as possible.  Up to SCHED_PHASE_STEPS offsets spread over the period are tried for each task (see SchedConfig.h).
+The cost of a task is its worst case execution time from SchedProfiler (measured or declared with
+SchedProfiler::setWcet()); tasks without one count as 1, so with no timings at all SchedPhase simply keeps the
+number of tasks due together as low as possible.
+
+Only active periodic tasks are moved (a function, 'next' not NEVER, period not ONESHOT).  A task is never moved
+earlier than its current 'next', so a task constructed to start in 10 seconds still waits at least 10 seconds.
+
+Planning takes time in proportion to the number of tasks squared and the hyperperiod; do it in setup().  When the
+hyperperiod is very long (periods with few common factors) only the first part of it is considered.
+
+With setAuto(true), setPeriod() only notes that a task needs placing again, so it stays cheap when called from a
+dispatched function (SchedElastic calls it every window).  The work is done by replan(), which the idle hook of
+SchedPhase calls after a pass that dispatched nothing; chain it with other hooks with SchedHookChain, or call
+replan() from loop().  A single changed task is placed against the others; if several changed, all are planned again.
+setAuto() uses the one period hook SchedBase has: only one user can have it, and setAuto(true) takes it over.
+
+	Change log
+
+		2026-10-19 initial coding
+		2026-10-19 costs looked up once per task per walk of the list
+		2026-10-19 setAuto() defers the re-placing to replan() (idle hook)
+*/
+
+#ifndef SchedPhase_h
+#define SchedPhase_h
+
+#include <SchedBase.h>
+#include <SchedProfiler.h>
+
+class SchedPhase {
+	public:
+
+		static void plan();												// stagger all active periodic tasks
+		static void place(SchedBase& task);							// stagger one task against all the others
+		static void setAuto(bool on);									// re-place a task after its setPeriod() is called (see replan())
+		static void replan();											// do the re-placing setAuto() has noted, if any
+		static unsigned long peak();									// cost due in the busiest millisecond with the current phases
+
+		static void preDispatch(SchedBase*) {}						// dispatch hooks: replan() after an idle pass
+		static void postDispatch(SchedBase*) {}
+		static void idle() {replan();}
+
+	private:
+
+		static bool active(SchedBase* task);						// active periodic task?
+		static unsigned long cost(SchedBase* task);				// WCET or 1
+		static unsigned long cost(SchedBase* task, int pos);	// same, for the task 'pos' places from the head
+		static bool before(SchedBase* a, unsigned long ca, SchedBase* b, unsigned long cb); // placement order: costly first, then short period
+		static unsigned long hyperperiod();							// lcm of the periods (limited)
+		static unsigned long phase(SchedBase* task, unsigned long base); // 'next' relative to base, within the period
+		static unsigned long loadAt(unsigned long t, unsigned long base, SchedBase* skip, SchedBase* upto, unsigned long uptoCost); // cost due at base + t
+		static void placeTask(SchedBase* task, unsigned long c, unsigned long base, SchedBase* upto); // choose and set the phase of task (cost c)
+		static void periodChanged(SchedBase* task);				// periodHook with setAuto(true)
+		static SchedBase* pending;										// task to place again, if any
+		static bool several;												// more than one task to place again: plan them all
+		static unsigned long gcd(unsigned long a, unsigned long b);
+};
+
+#endif
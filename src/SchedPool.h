@@ -0,0 +1,168 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedPool.h - fire-and-forget one shot timers from a fixed pool
+
+For short lived work ("turn the LED off in 200 ms") a SchedPool saves declaring a named SchedTask for every
+timer, and saves creating tasks with new at run time.  The pool holds N task slots; schedule() takes a free
+slot and dispatches the function once after 'delay' ms, after which the slot is free again.
+
+Syntax:
+
+	SchedPool<N> PoolName;											// N slots (1 to 255), functions take no parameter or an int
+	SchedPool<N, T> PoolName;										// functions take no parameter or a parameter of type T
+
+	SchedHandle h = PoolName.schedule(function, delay);		// dispatch function() once in 'delay' ms (NOW for immediately)
+	SchedHandle h = PoolName.schedule(function, delay, arg);	// dispatch function(arg) once
+	PoolName.cancel(h);												// don't dispatch it after all
+
+schedule() returns 0 (never a valid handle) when every slot is in use or the function is nullptr.  Taking and freeing a slot does not depend on N.
+
+Each handle carries a 24 bit generation number, so cancel() with a handle whose timer has already run (or been
+cancelled) returns false and does nothing, even if the slot has since been reused for another timer.  The
+generation of a slot wraps after 16777215 reuses, so a handle kept that long could match a new timer.
+
+Like other tasks the pool should be defined before setup().  The slots are tasks in the dispatcher list and
+count in getTaskCount(); a free slot costs the dispatcher one check.
+
+	Change log
+
+		2026-10-19 initial coding
+		2026-10-19 32 bit handles with a 24 bit generation (an 8 bit one wrapped after 255 reuses of a slot)
+		2026-10-19 schedule() refuses a null function (the slot was never freed)
+*/
+
+#ifndef SchedPool_h
+#define SchedPool_h
+
+#include <SchedBase.h>
+
+typedef uint32_t SchedHandle;											// generation in the high 24 bits, slot in the low byte; 0 is never valid
+
+template <int N, typename T=int>
+class SchedPool {
+	typedef void (*pFunc)();
+	typedef void (*pFuncT)(T);
+
+	static_assert(N > 0 && N < 256, "SchedPool size must be 1 to 255");
+
+	public:
+		SchedPool();															// constructor
+
+		SchedHandle schedule(pFunc fun, unsigned long delay);		// dispatch fun() once after delay ms
+		SchedHandle schedule(pFuncT fun, unsigned long delay, T arg); // dispatch fun(arg) once after delay ms
+		bool cancel(SchedHandle handle);									// false if the timer already ran or was cancelled
+		bool isPending(SchedHandle handle);								// timer still waiting to run?
+		int getFree() {return freeCount;}								// slots available
+
+	private:
+
+		class Slot : public SchedBase {									// one pooled task
+			typedef void (*pFunc)();
+
+			public:
+				Slot() : func(nullptr), funcT(nullptr), parm() {}
+				void setFunc(pFunc) {;}										// overrides pure virtual in base
+				pFunc getFunc() {return func;}
+
+				SchedPool* pool;												// owner, to free the slot once it has run
+				pFunc func;														// one of these is set while the slot is in use
+				pFuncT funcT;
+				T parm;															// passed to funcT
+				uint32_t gen;													// generation (24 bits), bumped each time the slot is freed
+				uint8_t nextFree;												// free list link (N = end of list)
+
+			private:
+				virtual void callFunc();
+				virtual bool checkFunc() {return func != nullptr || funcT != nullptr;}
+		};
+
+		Slot slots[N];
+		uint8_t freeHead;														// first free slot (N = none)
+		uint8_t freeCount;													// number of free slots
+
+		Slot* take(unsigned long delay);									// allocate a slot and set its next
+		void release(Slot* slot);											// return a slot to the free list
+		Slot* find(SchedHandle handle);									// the in-use slot for handle, or nullptr
+		SchedHandle handleOf(Slot* slot) {return ((SchedHandle)slot->gen << 8) | (slot - slots);}
+};
+
+// constructor
+template <int N, typename T> SchedPool<N, T>::SchedPool() : freeHead(0), freeCount(N) {
+	for (int i=0; i<N; i++) {
+		slots[i].pool = this;
+		slots[i].gen = 1;
+		slots[i].nextFree = i + 1;										// chain every slot on the free list
+	}
+}
+// schedule()
+template <int N, typename T> SchedHandle SchedPool<N, T>::schedule(pFunc fun, unsigned long delay) {
+	if (!fun) return 0;													// a slot without a function would never be freed
+	Slot* slot = take(delay);
+	if (!slot) return 0;
+	slot->func = fun;
+	return handleOf(slot);
+}
+template <int N, typename T> SchedHandle SchedPool<N, T>::schedule(pFuncT fun, unsigned long delay, T arg) {
+	if (!fun) return 0;
+	Slot* slot = take(delay);
+	if (!slot) return 0;
+	slot->funcT = fun;
+	slot->parm = arg;
+	return handleOf(slot);
+}
+// cancel()
+template <int N, typename T> bool SchedPool<N, T>::cancel(SchedHandle handle) {
+	Slot* slot = find(handle);
+	if (!slot) return false;											// stale or invalid handle, nothing to do
+	slot->setNext(NEVER);
+	release(slot);
+	return true;
+}
+// isPending()
+template <int N, typename T> bool SchedPool<N, T>::isPending(SchedHandle handle) {
+	return find(handle) != nullptr;
+}
+// take()
+template <int N, typename T> typename SchedPool<N, T>::Slot* SchedPool<N, T>::take(unsigned long delay) {
+	if (freeHead == N) return nullptr;								// pool exhausted
+	Slot* slot = &slots[freeHead];
+	freeHead = slot->nextFree;
+	freeCount--;
+	slot->setPeriod(ONESHOT);
+	slot->setIterations(-1);
+	slot->setNext(delay);
+	return slot;
+}
+// release()
+template <int N, typename T> void SchedPool<N, T>::release(Slot* slot) {
+	slot->func = nullptr;
+	slot->funcT = nullptr;
+	if (++slot->gen > 0xFFFFFFUL) slot->gen = 1;				// handles from before are now stale; 0 is never used
+	slot->nextFree = freeHead;
+	freeHead = slot - slots;
+	freeCount++;
+}
+// find()
+template <int N, typename T> typename SchedPool<N, T>::Slot* SchedPool<N, T>::find(SchedHandle handle) {
+	uint8_t index = handle & 0xFF;
+	if (index >= N) return nullptr;
+	Slot* slot = &slots[index];
+	if (slot->gen != (handle >> 8) || (!slot->func && !slot->funcT)) return nullptr; // stale or free
+	return slot;
+}
+// callFunc() - the slot is free again before the function runs, so the function may schedule more timers
+template <int N, typename T> void SchedPool<N, T>::Slot::callFunc() {
+	pFunc f = func;
+	pFuncT fT = funcT;
+	T arg = parm;
+	pool->release(this);
+	if (f) f();
+	else fT(arg);
+}
+
+#endif
@@ -0,0 +1,38 @@
+/*
+	SchedProfiler.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 take the ID from the dispatcher rather than getTaskID() (a list walk with SCHED_COMPACT)
+		2026-10-19 ignore a negative ID, as setWcet() does
+*/
+
+#include <SchedProfiler.h>
+
+unsigned long SchedProfiler::start = 0;
+unsigned long SchedProfiler::wcet[SCHED_PROFILE_TASKS];
+unsigned long SchedProfiler::count[SCHED_PROFILE_TASKS];
+
+// postDispatch()
+void SchedProfiler::postDispatch(SchedBase*) {			// the task has returned; record how long it took
+	unsigned long elapsed = micros() - start;
+	int id = SchedBase::getDispatchID();
+	if (id >= 0 && id < SCHED_PROFILE_TASKS) {
+		if (elapsed > wcet[id]) wcet[id] = elapsed;			// new worst case
+		count[id]++;
+	}
+}
+// setWcet()
+void SchedProfiler::setWcet(int id, unsigned long us) {		// declared cost; keep the larger of declared and measured
+	if (id >= 0 && id < SCHED_PROFILE_TASKS && us > wcet[id]) {
+		wcet[id] = us;
+	}
+}
+// reset()
+void SchedProfiler::reset() {
+	for (int i=0; i<SCHED_PROFILE_TASKS; i++) {
+		wcet[i] = 0;
+		count[i] = 0;
+	}
+}
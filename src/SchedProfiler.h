@@ -0,0 +1,54 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedProfiler.h - measures how long each task takes to run
+
+SchedProfiler is a set of dispatch hooks (see SchedBase.h) that records the worst case execution time
+(WCET) in microseconds and the number of dispatches of each task, by task ID.  Use it in loop():
+
+	SchedBase::dispatcher<SchedProfiler>();
+
+Costs that are known in advance (or tasks that have not run yet) can be declared with setWcet(); the
+larger of the declared and measured values is kept.
+
+Only tasks with an ID below SCHED_PROFILE_TASKS (see SchedConfig.h) are recorded.
+
+SchedReport (SchedReport.h) uses these timings to compute utilization and schedulability.
+
+	Change log
+
+		2026-10-19 initial coding
+		2026-10-19 no list walk per dispatch with SCHED_COMPACT
+		2026-10-19 wantsID; ignore a negative ID
+*/
+
+#ifndef SchedProfiler_h
+#define SchedProfiler_h
+
+#include <SchedBase.h>
+
+class SchedProfiler {
+	public:
+
+		static const bool wantsID = true;								// postDispatch() uses SchedBase::getDispatchID()
+		static void preDispatch(SchedBase*) {start = micros();}		// dispatch hooks
+		static void postDispatch(SchedBase*);
+		static void idle() {}
+
+		static unsigned long getWcet(int id) {return id >= 0 && id < SCHED_PROFILE_TASKS ? wcet[id] : 0;} // worst case execution time in us
+		static void setWcet(int id, unsigned long us);						// declare a worst case execution time
+		static unsigned long getCount(int id) {return id >= 0 && id < SCHED_PROFILE_TASKS ? count[id] : 0;} // dispatches recorded
+		static void reset();															// forget all timings
+
+	private:
+
+		static unsigned long start;												// micros() when the current task was called
+		static unsigned long wcet[SCHED_PROFILE_TASKS];						// worst case execution time by task ID
+		static unsigned long count[SCHED_PROFILE_TASKS];					// dispatches by task ID
+};
+
+#endif
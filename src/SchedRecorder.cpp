@@ -0,0 +1,148 @@
+/*
+	SchedRecorder.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 IDs from the list position when logging every task
+		2026-10-19 retirements logged with the ID from the dispatcher; pass start from cursorID
+*/
+
+#include <SchedBase.h>
+
+#if SCHED_RECORD
+
+#include <SchedRecorder.h>
+
+uint8_t* SchedRecorder::buffer = nullptr;
+size_t SchedRecorder::size = 0;
+size_t SchedRecorder::length = 0;
+bool SchedRecorder::full = false;
+bool SchedRecorder::inDispatch = false;
+bool SchedRecorder::dispatched = false;
+bool SchedRecorder::noted = false;
+size_t SchedRecorder::passStart = 0;
+unsigned long SchedRecorder::passClock = 0;
+unsigned long SchedRecorder::last = 0;
+SchedRecorder::pClock SchedRecorder::savedClock = nullptr;
+
+// begin()
+void SchedRecorder::begin(uint8_t* buf, size_t len) {
+	if (buffer) end();
+	buffer = buf;
+	size = len;
+	length = 0;
+	full = false;
+	inDispatch = false;
+	savedClock = SchedBase::getClock();
+	last = savedClock();
+	put(START);
+	putNumber(last);
+	int pos = 0;
+	for (SchedBase* pTask = SchedBase::getFirstTask(); pTask; pTask = pTask->getNextTask(), pos++) {
+		logTask(TASK, pTask, pTask->getTaskID(pos));
+	}
+	SchedBase::setClock(readClock);
+	SchedBase::changeHook = changed;
+}
+// end()
+void SchedRecorder::end() {
+	if (!buffer) return;
+	SchedBase::setClock(savedClock);
+	SchedBase::changeHook = nullptr;
+	buffer = nullptr;
+}
+// mark()
+void SchedRecorder::mark(uint8_t code, unsigned long value) {
+	if (!buffer || full) return;
+	size_t start = length;
+	put(MARK);
+	put(code);
+	putNumber(value);
+	if (full) length = start;										// no partial records
+	noted = true;
+}
+// readClock()
+unsigned long SchedRecorder::readClock() {
+	unsigned long now = savedClock();
+	if (buffer && !full) {
+		size_t start = length;
+		unsigned long delta = now - last;
+		if (delta <= CLOCK_MAX) {
+			put(delta);
+		}
+		else {
+			put(CLOCK);
+			putNumber(delta);
+		}
+		if (full) length = start;
+		last = now;
+	}
+	return now;
+}
+// changed()
+void SchedRecorder::changed(SchedBase* task, int id) {
+	if (inDispatch || !buffer || full) return;					// the replay makes this change itself
+	size_t start = length;
+	logTask(CHANGE, task, id >= 0 ? id : task->getTaskID());	// a setter doesn't know the ID (a walk of the list with SCHED_COMPACT)
+	if (full) length = start;
+	noted = true;
+}
+// logTask()
+void SchedRecorder::logTask(uint8_t tag, SchedBase* task, int id) {
+	put(tag);
+	putNumber(id);
+	putNumber(task->next);
+	putNumber(task->getPeriod());
+	putNumber(task->iterations + 1);								// -1 (not specified) is 0
+}
+// beginPass()
+void SchedRecorder::beginPass() {
+	if (!buffer || full) return;
+	passStart = length;
+	passClock = last;
+	dispatched = false;
+	noted = false;
+	put(PASS);
+#if SCHED_ROTATE
+#if SCHED_COMPACT
+	putNumber(SchedBase::cursor ? SchedBase::cursorID + 1 : 0); // where the pass starts; dropped passes move it on
+#else
+	putNumber(SchedBase::cursor ? SchedBase::cursor->getTaskID() + 1 : 0);
+#endif
+#endif
+}
+// endPass()
+void SchedRecorder::endPass() {
+	if (!buffer) return;
+	if (full) {
+		length = passStart;											// drop the part of the pass that fitted
+		return;
+	}
+	if (!dispatched && !noted) {										// nothing to replay: forget the pass
+		length = passStart;
+		last = passClock;
+		return;
+	}
+	put(DONE);
+	if (full) length = passStart;
+}
+// put()
+bool SchedRecorder::put(uint8_t b) {
+	if (length >= size) {
+		full = true;
+		return false;
+	}
+	buffer[length++] = b;
+	return true;
+}
+// putNumber()
+bool SchedRecorder::putNumber(unsigned long value) {
+	while (value > 0x7F) {
+		if (!put(0x80 | (value & 0x7F))) return false;
+		value >>= 7;
+	}
+	return put(value);
+}
+
+#endif
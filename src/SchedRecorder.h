@@ -0,0 +1,132 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedRecorder.h - record what the dispatcher sees so it can be replayed exactly (see SchedReplay.h)
+
+Requires SCHED_RECORD 1 in SchedConfig.h (or in the build flags).
+
+A timing bug that shows up only after a particular sequence of events is hard to reproduce on the bench.
+SchedRecorder keeps a compact log of everything that decides what the dispatcher does: the state of every task
+when recording starts, each clock reading, each setNext(), setPeriod() and setIterations() made from outside a
+dispatched function (from loop() or an interrupt), and any inputs the sketch notes with mark().  SchedReplay feeds
+the log back through the same dispatcher, usually in a host build, and gets the same dispatches in the same order.
+
+	uint8_t log[2000];
+
+	SchedRecorder::begin(log, sizeof(log));					// in setup(), after the tasks are set up
+	...
+	void loop() {
+		SchedRecorder::dispatcher();								// instead of SchedBase::dispatcher(); also dispatcher<Hooks>()
+		if (buttonPressed()) {
+			SchedRecorder::mark(BUTTON);							// optional: note the input for the replay
+			AlarmTask.setNext(NOW);									// recorded
+		}
+	}
+	...
+	SchedRecorder::end();											// then send log[0 .. getLength()-1] somewhere
+
+Passes of the dispatcher that dispatch nothing (and retire no task) are left out of the log, so it grows with the dispatches, not the
+passes: a clock reading is usually one byte and each recorded pass takes two more plus one for each task it
+looks at.  Recording stops (isFull() is true) when the buffer is full; the log up to there can still be replayed.
+
+Changes made by dispatched functions are not logged since the replay runs the same functions and makes them
+again.  For the same reason dispatched functions should read the time with SchedBase::getTime(), not millis().
+SchedGroup changes are not logged.
+
+Only the state every task has (next, period, iterations) is recorded at begin().  State kept by the task classes
+themselves is not: the phase and times of a SchedDuty, the functions and parameters of SchedPool slots, the
+members of a SchedTaskGroup, the parameter of a SchedTaskT, and so on.  The replay starts these from whatever the
+replaying sketch has, so call begin() in setup() before the first dispatch (when they still hold their
+constructor values) and don't change them with their own setters while recording; otherwise the replay can
+diverge.
+
+Log format, one byte tag and then unsigned LEB128 numbers:
+	0x00-0xDF				clock read, this many ms after the last
+	0xE0 delta				clock read
+	0xF0 {cursor}			start of a dispatcher pass (with SCHED_ROTATE: ID + 1 of the task it starts at, 0 for the head)
+	0xF1						end of the pass
+	0xF2 id next period iterations+1		task state (raw values) after a setter call or a retirement
+	0xF3 code value		mark()
+	0xF4 time				first clock value
+	0xF5 id next period iterations+1		task state when recording started
+
+	Change log
+
+		2026-10-19 initial coding
+		2026-10-19 document that state held by derived task classes is not recorded
+		2026-10-19 IDs without a walk of the list in each pass with SCHED_COMPACT (wantsID, cursorID)
+*/
+
+#ifndef SchedRecorder_h
+#define SchedRecorder_h
+
+#include <SchedBase.h>
+
+#if !SCHED_RECORD
+#error "SchedRecorder needs SCHED_RECORD set to 1 in SchedConfig.h or the build flags"
+#endif
+
+class SchedRecorder {
+	typedef unsigned long (*pClock)();
+
+	public:
+
+		static void begin(uint8_t* buf, size_t len);				// record the tasks and start logging into buf
+		static void end();												// stop logging
+		static size_t getLength() {return length;}				// bytes logged
+		static bool isFull() {return full;}							// logging stopped because buf is full
+		static bool isRecording() {return buffer != nullptr;}
+		static void mark(uint8_t code, unsigned long value = 0); // note an input, passed to the replay's mark function
+
+		static void dispatcher() {dispatcher<SchedNoHooks>();}	// the dispatcher, recorded
+		template <class Hooks> static void dispatcher();
+
+		static void preDispatch(SchedBase*) {inDispatch = true;} // dispatch hooks: changes made by dispatched functions are not logged
+		static void postDispatch(SchedBase*) {inDispatch = false; dispatched = true;}
+		static void idle() {}
+		static const bool wantsID = true;								// the dispatcher passes changed() the ID of a task it retires
+
+		// log tags, shared with SchedReplay
+		static const uint8_t CLOCK_MAX = 0xDF;						// largest delta in a single byte
+		static const uint8_t CLOCK = 0xE0;
+		static const uint8_t PASS = 0xF0;
+		static const uint8_t DONE = 0xF1;
+		static const uint8_t CHANGE = 0xF2;
+		static const uint8_t MARK = 0xF3;
+		static const uint8_t START = 0xF4;
+		static const uint8_t TASK = 0xF5;
+
+	private:
+
+		static uint8_t* buffer;											// nullptr when not recording
+		static size_t size;
+		static size_t length;
+		static bool full;
+		static bool inDispatch;											// a dispatched function is running
+		static bool dispatched;											// the current pass dispatched something
+		static bool noted;												// the current pass logged a change or mark
+		static size_t passStart;										// length when the current pass started
+		static unsigned long passClock;								// 'last' when the current pass started
+		static unsigned long last;										// last clock value logged
+		static pClock savedClock;										// clock wrapped by readClock()
+
+		static unsigned long readClock();							// clock source while recording
+		static void changed(SchedBase* task, int id);			// SchedBase::changeHook
+		static void logTask(uint8_t tag, SchedBase* task, int id); // log a task's state
+		static void beginPass();
+		static void endPass();
+		static bool put(uint8_t b);									// false once the buffer is full
+		static bool putNumber(unsigned long value);				// LEB128
+};
+
+template <class Hooks> void SchedRecorder::dispatcher() {
+	beginPass();
+	SchedBase::dispatcher<SchedHookChain<SchedRecorder, Hooks> >();
+	endPass();
+}
+
+#endif
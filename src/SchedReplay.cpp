@@ -0,0 +1,172 @@
+/*
+	SchedReplay.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 apply changes logged after the last clock read of a pass
+		2026-10-19 IDs from the list position, so SCHED_COMPACT builds don't walk the list for each one
+		2026-10-19 list positions no longer shadow the member pos; cursorID set with the cursor
+*/
+
+#include <SchedBase.h>
+
+#if SCHED_RECORD
+
+#include <SchedReplay.h>
+
+const uint8_t* SchedReplay::log = nullptr;
+size_t SchedReplay::length = 0;
+size_t SchedReplay::pos = 0;
+unsigned long SchedReplay::time = 0;
+unsigned long SchedReplay::passes = 0;
+bool SchedReplay::lost = false;
+SchedReplay::pMark SchedReplay::markFunc = nullptr;
+SchedReplay::pClock SchedReplay::savedClock = nullptr;
+
+// start()
+bool SchedReplay::start(const uint8_t* buf, size_t len, pMark mark) {
+	log = buf;
+	length = len;
+	pos = 0;
+	passes = 0;
+	lost = false;
+	markFunc = mark;
+	if (len == 0 || buf[pos++] != SchedRecorder::START || !getNumber(time)) return false;
+	while (pos < length && log[pos] == SchedRecorder::TASK) {	// the tasks as they were when recording started
+		if (!apply()) return false;
+	}
+	savedClock = SchedBase::getClock();
+	SchedBase::setClock(readClock);
+	return true;
+}
+// finish()
+void SchedReplay::finish() {
+	SchedBase::setClock(savedClock);
+}
+// step()
+int SchedReplay::step() {
+	while (pos < length) {
+		uint8_t tag = log[pos];
+		unsigned long delta;
+		if (tag <= SchedRecorder::CLOCK_MAX) {						// read outside a pass, e.g. by setNext() in loop()
+			time += tag;
+			pos++;
+		}
+		else if (tag == SchedRecorder::CLOCK) {
+			pos++;
+			if (!getNumber(delta)) break;
+			time += delta;
+		}
+		else if (tag == SchedRecorder::PASS) {
+			pos++;
+#if SCHED_ROTATE
+			unsigned long id;
+			if (!getNumber(id)) break;
+			SchedBase::cursor = nullptr;
+			int at = 0;
+			for (SchedBase* pTask = SchedBase::getFirstTask(); id && pTask; pTask = pTask->getNextTask(), at++) {
+				if ((unsigned long)pTask->getTaskID(at) + 1 == id) {
+					SchedBase::cursor = pTask;
+					break;
+				}
+			}
+#if SCHED_COMPACT
+			SchedBase::cursorID = (int)id - 1;							// as the dispatcher would have it
+#endif
+#endif
+			return 1;
+		}
+		else if (tag == SchedRecorder::CHANGE || tag == SchedRecorder::MARK) {
+			if (!apply()) break;
+		}
+		else {
+			break;
+		}
+	}
+	if (pos >= length) return 0;										// end of the log
+	lost = true;															// damaged, or not the same tasks as when recording
+	return -1;
+}
+// endPass()
+bool SchedReplay::endPass() {
+	if (lost) return false;
+	while (pos < length && (log[pos] == SchedRecorder::CHANGE || log[pos] == SchedRecorder::MARK)) {
+		if (!apply()) {													// logged after the pass's last clock read, e.g. a retirement
+			lost = true;
+			return false;
+		}
+	}
+	if (pos < length && log[pos] == SchedRecorder::DONE) {
+		pos++;
+		return true;
+	}
+	lost = true;															// the pass didn't read the clock as often as when recording
+	return false;
+}
+// readClock() - the next clock value recorded, putting back any changes logged before it
+unsigned long SchedReplay::readClock() {
+	while (!lost) {
+		if (pos >= length) {
+			lost = true;
+			break;
+		}
+		uint8_t tag = log[pos];
+		unsigned long delta;
+		if (tag <= SchedRecorder::CLOCK_MAX) {
+			time += tag;
+			pos++;
+			break;
+		}
+		else if (tag == SchedRecorder::CLOCK) {
+			pos++;
+			if (!getNumber(delta)) lost = true;
+			else time += delta;
+			break;
+		}
+		else if (tag == SchedRecorder::CHANGE || tag == SchedRecorder::MARK) {	// made by an interrupt during the pass
+			if (!apply()) lost = true;
+		}
+		else {
+			lost = true;													// read the clock more often than when recording
+		}
+	}
+	return time;
+}
+// apply()
+bool SchedReplay::apply() {
+	uint8_t tag = log[pos++];
+	if (tag == SchedRecorder::MARK) {
+		unsigned long value;
+		if (pos >= length) return false;
+		uint8_t code = log[pos++];
+		if (!getNumber(value)) return false;
+		if (markFunc) markFunc(code, value);
+		return true;
+	}
+	unsigned long id, next, period, iterations;
+	if (!getNumber(id) || !getNumber(next) || !getNumber(period) || !getNumber(iterations)) return false;
+	int at = 0;
+	for (SchedBase* pTask = SchedBase::getFirstTask(); pTask; pTask = pTask->getNextTask(), at++) {
+		if ((unsigned long)pTask->getTaskID(at) == id) {
+			pTask->next = next;
+			pTask->period = SchedBase::encodePeriod(period);
+			pTask->iterations = (long)iterations - 1;
+			return true;
+		}
+	}
+	return false;															// not the same tasks as when recording
+}
+// getNumber()
+bool SchedReplay::getNumber(unsigned long& value) {
+	value = 0;
+	for (int shift=0; shift<35; shift+=7) {
+		if (pos >= length) return false;
+		uint8_t b = log[pos++];
+		value |= (unsigned long)(b & 0x7F) << shift;
+		if (!(b & 0x80)) return true;
+	}
+	return false;
+}
+
+#endif
@@ -0,0 +1,79 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedReplay.h - replay a log made by SchedRecorder through the dispatcher
+
+Build the same sketch (same tasks in the same order, same dispatched functions), usually on a host with a stand in
+Arduino.h, and run:
+
+	void mark(uint8_t code, unsigned long value) {...}		// optional: called for each SchedRecorder::mark()
+
+	bool ok = SchedReplay::run(log, length, mark);
+
+run() puts every task in the state it had when recording started, then goes through the log: the clock reads
+recorded are handed back one by one to whatever reads the clock, changes made outside dispatched functions are
+put back as they were made, and SchedBase::dispatcher() (unchanged) is called for each recorded pass.  Dispatch
+hooks can be passed with run<Hooks>() to trace or time the replay.  run() returns false if the replay stopped
+matching the log (a pass read the clock a different number of times than when recording, or the log is damaged);
+getPasses() tells how far it got.
+
+The SchedConfig.h settings should be the same as when recording.
+
+	Change log
+
+		2026-10-19 initial coding
+*/
+
+#ifndef SchedReplay_h
+#define SchedReplay_h
+
+#include <SchedRecorder.h>
+
+class SchedReplay {
+	typedef unsigned long (*pClock)();
+	typedef void (*pMark)(uint8_t code, unsigned long value);
+
+	public:
+
+		static bool run(const uint8_t* buf, size_t len, pMark mark = nullptr) {return run<SchedNoHooks>(buf, len, mark);}
+		template <class Hooks> static bool run(const uint8_t* buf, size_t len, pMark mark = nullptr);
+		static unsigned long now() {return time;}					// clock value last handed out
+		static unsigned long getPasses() {return passes;}		// passes replayed
+
+	private:
+
+		static const uint8_t* log;
+		static size_t length;
+		static size_t pos;
+		static unsigned long time;
+		static unsigned long passes;
+		static bool lost;													// the replay no longer matches the log
+		static pMark markFunc;
+		static pClock savedClock;
+
+		static bool start(const uint8_t* buf, size_t len, pMark mark); // restore the tasks; false if not a log
+		static int step();												// apply records up to the next pass; PASS, 0 at the end, -1 if lost
+		static bool endPass();											// the pass used all its clock reads
+		static void finish();
+		static unsigned long readClock();							// clock source while replaying
+		static bool apply();											// apply a CHANGE, MARK or TASK record at pos
+		static bool getNumber(unsigned long& value);
+};
+
+template <class Hooks> bool SchedReplay::run(const uint8_t* buf, size_t len, pMark mark) {
+	if (!start(buf, len, mark)) return false;
+	int r;
+	while ((r = step()) > 0) {
+		SchedBase::dispatcher<Hooks>();								// the production dispatcher
+		passes++;
+		if (!endPass()) break;
+	}
+	finish();
+	return !lost;
+}
+
+#endif
@@ -0,0 +1,137 @@
+/*
+	SchedReport.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 suspended group members don't load the CPU
+		2026-10-19 IDs from the list position, so SCHED_COMPACT builds don't walk the list for each one
+		2026-10-19 print() finds the shortest period once, not once per task
+*/
+
+#include <SchedReport.h>
+
+// counted()
+bool SchedReport::counted(SchedBase* task) {						// only active periodic tasks load the CPU
+	return !task->isSuspended() && task->checkFunc() && task->next != NEVER && task->period != ONESHOT;
+}
+// bound()
+float SchedReport::bound(int n) {									// Liu & Layland utilization bound
+	return n > 0 ? n * (pow(2.0, 1.0 / n) - 1.0) : 1.0;
+}
+// taskLoad()
+bool SchedReport::taskLoad(SchedBase& task, SchedTaskLoad& tl) {
+	if (!counted(&task)) return false;
+	unsigned long minPeriod = 0xFFFFFFFFUL;
+	for (SchedBase* pTask = SchedBase::tasksHead; pTask; pTask = pTask->taskLink) {
+		if (counted(pTask) && pTask->getPeriod() < minPeriod) minPeriod = pTask->getPeriod();
+	}
+	fill(&task, task.getTaskID(), minPeriod, tl);
+	return true;
+}
+// fill()
+void SchedReport::fill(SchedBase* task, int id, unsigned long minPeriod, SchedTaskLoad& tl) {
+	tl.taskID = id;
+	tl.period = task->getPeriod();
+	tl.wcet = SchedProfiler::getWcet(id);
+	tl.utilization = tl.wcet / (tl.period * 1000.0);		// us / ms
+	tl.tooLong = tl.wcet > minPeriod * 1000.0;
+}
+// compute()
+void SchedReport::compute(SchedLoad& load) {
+	load.tasks = 0;
+	load.tooLong = 0;
+	load.unmeasured = 0;
+	load.minPeriod = 0xFFFFFFFFUL;
+	load.maxWcet = 0;
+	load.utilization = 0.0;
+	load.rmOK = true;
+
+	int pos = 0;
+	for (SchedBase* pTask = SchedBase::tasksHead; pTask; pTask = pTask->taskLink, pos++) {	// totals
+		if (!counted(pTask)) continue;
+		unsigned long wcet = SchedProfiler::getWcet(pTask->getTaskID(pos));
+		load.tasks++;
+		if (wcet == 0) load.unmeasured++;
+		if (pTask->getPeriod() < load.minPeriod) load.minPeriod = pTask->getPeriod();
+		if (wcet > load.maxWcet) load.maxWcet = wcet;
+		load.utilization += wcet / (pTask->getPeriod() * 1000.0);
+	}
+	if (load.tasks == 0) load.minPeriod = 0;
+
+	pos = 0;
+	for (SchedBase* pTask = SchedBase::tasksHead; pTask; pTask = pTask->taskLink, pos++) {	// per task tests
+		if (!counted(pTask)) continue;
+		unsigned long period = pTask->getPeriod();
+		if (SchedProfiler::getWcet(pTask->getTaskID(pos)) > load.minPeriod * 1000.0) load.tooLong++;
+
+		int n = 0;															// tasks with the same or higher RM priority
+		float u = 0.0;														// and their utilization
+		unsigned long blocking = 0;									// longest lower priority task that may be running
+		int other = 0;
+		for (SchedBase* pOther = SchedBase::tasksHead; pOther; pOther = pOther->taskLink, other++) {
+			if (!counted(pOther)) continue;
+			unsigned long wcet = SchedProfiler::getWcet(pOther->getTaskID(other));
+			if (pOther->getPeriod() <= period) {
+				n++;
+				u += wcet / (pOther->getPeriod() * 1000.0);
+			}
+			else if (wcet > blocking) {
+				blocking = wcet;
+			}
+		}
+		if (u + blocking / (period * 1000.0) > bound(n)) load.rmOK = false;
+	}
+
+	load.rmBound = bound(load.tasks);
+	load.edfOK = load.tasks == 0 || load.utilization + load.maxWcet / (load.minPeriod * 1000.0) <= 1.0;
+}
+// print()
+void SchedReport::print(Print& out) {
+	SchedLoad load;
+	compute(load);
+
+	out.print("\ntask\tperiod\twcet us\tutil %");
+	int pos = 0;
+	for (SchedBase* pTask = SchedBase::tasksHead; pTask; pTask = pTask->taskLink, pos++) {
+		if (!counted(pTask)) continue;
+		SchedTaskLoad tl;
+		fill(pTask, pTask->getTaskID(pos), load.minPeriod, tl);	// the shortest period is already in load
+		out.print("\n");
+		out.print(tl.taskID);
+		out.print("\t");
+		out.print(tl.period);
+		out.print("\t");
+		out.print(tl.wcet);
+		out.print("\t");
+		out.print(tl.utilization * 100.0, 2);
+		if (tl.tooLong) out.print("\tWCET exceeds shortest period");
+		else if (tl.wcet == 0) out.print("\tnot measured");
+	}
+	out.print("\n\ntasks ");
+	out.print(load.tasks);
+	out.print(", utilization ");
+	out.print(load.utilization * 100.0, 2);
+	out.print("%, shortest period ");
+	out.print(load.minPeriod);
+	out.print(" ms, longest WCET ");
+	out.print(load.maxWcet);
+	out.print(" us");
+	out.print("\nrate monotonic (bound ");
+	out.print(load.rmBound * 100.0, 2);
+	out.print("%): ");
+	out.print(load.rmOK ? "schedulable" : "NOT schedulable");
+	out.print("\nearliest deadline first: ");
+	out.print(load.edfOK ? "schedulable" : "NOT schedulable");
+	if (load.tooLong) {
+		out.print("\n");
+		out.print(load.tooLong);
+		out.print(" task(s) with WCET above the shortest period");
+	}
+	if (load.unmeasured) {
+		out.print("\n");
+		out.print(load.unmeasured);
+		out.print(" task(s) not measured yet");
+	}
+	out.print("\n");
+}
@@ -0,0 +1,84 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedReport.h - CPU utilization and schedulability of the current task set
+
+SchedReport combines the period of every periodic task with its worst case execution time (WCET) from
+SchedProfiler (measured, or declared with SchedProfiler::setWcet()) to answer "will every task still meet
+its period?"  Use it before adding another task to a busy sketch.
+
+	SchedReport::print(Serial);										// print the whole report
+
+	SchedLoad load;
+	SchedReport::compute(load);										// or just get the totals
+	if (!load.edfOK) ...
+
+	SchedTaskLoad tl;
+	SchedReport::taskLoad(Task, tl);								// and the figures for one task
+
+Only periodic tasks that are active (a function, 'next' not NEVER, period not ONESHOT) are counted.
+
+The dispatcher is cooperative: a task that is due must wait for the task currently running to return.  The
+tests below therefore include that blocking time, so they are stricter than the textbook preemptive bounds.
+
+	Rate monotonic (shortest period first), for each task i in order of period:
+		sum of C/T over tasks with period <= T(i), plus B(i)/T(i), must not exceed n(2^(1/n) - 1)
+		where n is the number of those tasks and B(i) is the longest WCET of any task with a longer period
+
+	Earliest deadline first:
+		total utilization plus (longest WCET / shortest period) must not exceed 1
+
+Any task whose WCET exceeds the shortest period in the system is flagged: while it runs, the task with the
+shortest period is bound to miss at least one dispatch.
+
+	Change log
+
+		2026-10-19 initial coding
+		2026-10-19 print() is linear in the number of tasks apart from the RM test
+*/
+
+#ifndef SchedReport_h
+#define SchedReport_h
+
+#include <SchedBase.h>
+#include <SchedProfiler.h>
+
+struct SchedTaskLoad {													// figures for one task
+	int taskID;																// getTaskID()
+	unsigned long period;												// getPeriod() in ms
+	unsigned long wcet;													// worst case execution time in us
+	float utilization;													// wcet / period, 0.0 to 1.0
+	bool tooLong;															// wcet exceeds the shortest period in the system
+};
+
+struct SchedLoad {														// figures for the whole task set
+	int tasks;																// active periodic tasks counted
+	int tooLong;															// tasks flagged as tooLong
+	int unmeasured;														// tasks with no WCET yet (counted as 0)
+	unsigned long minPeriod;											// shortest period in ms
+	unsigned long maxWcet;												// longest WCET in us
+	float utilization;													// total utilization, 0.0 to 1.0 (and above when overloaded)
+	float rmBound;															// n(2^(1/n) - 1) for all the tasks
+	bool rmOK;																// passes the rate monotonic test
+	bool edfOK;																// passes the earliest deadline first test
+};
+
+class SchedReport {
+	public:
+
+		static void compute(SchedLoad& load);						// totals and schedulability tests
+		static bool taskLoad(SchedBase& task, SchedTaskLoad& tl); // figures for one task; false if the task is not counted
+		static void print(Print& out);								// print a table of tasks and the totals
+
+	private:
+
+		static bool counted(SchedBase* task);						// active periodic task?
+		static float bound(int n);										// n(2^(1/n) - 1)
+		static void fill(SchedBase* task, int id, unsigned long minPeriod, SchedTaskLoad& tl); // figures for one counted task
+};
+
+#endif
@@ -0,0 +1,54 @@
+/*
+	SchedSim.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 32 bit virtual clock and comparisons
+*/
+
+#include <SchedSim.h>
+
+uint32_t SchedSim::virtualTime = 0;
+unsigned long SchedSim::passes = 0;
+SchedSim::pClock SchedSim::savedClock = nullptr;
+
+// begin()
+void SchedSim::begin(unsigned long start) {						// switch the dispatcher to virtual time
+	if (SchedBase::getClock() != readClock) {					// don't lose the real clock if begin() is called twice
+		savedClock = SchedBase::getClock();
+	}
+	virtualTime = start;
+	passes = 0;
+	SchedBase::setClock(readClock);
+}
+// end()
+void SchedSim::end() {													// back to the real clock
+	if (savedClock) {
+		SchedBase::setClock(savedClock);
+		savedClock = nullptr;
+	}
+}
+// runFor()
+void SchedSim::runFor(unsigned long ms) {							// split into spans the signed comparisons can handle
+	const unsigned long SPAN = 0x3FFFFFFFUL;						// ~12 days
+	while (ms > SPAN) {
+		runUntil(virtualTime + SPAN);
+		ms -= SPAN;
+	}
+	runUntil(virtualTime + ms);
+}
+// runUntil()
+void SchedSim::runUntil(unsigned long until) {					// dispatch every task due up to 'until'
+	unsigned long when;
+	while (SchedBase::getEarliest(when) && (int32_t)(when - until) <= 0) {
+		if ((int32_t)(when - virtualTime) > 0) {			// never move the clock backwards
+			virtualTime = when;										// jump straight to the next event
+		}
+		SchedBase::dispatcher();										// the production dispatcher
+		passes++;
+	}
+	if ((int32_t)(until - virtualTime) > 0) {				// nothing more due; idle up to 'until'
+		virtualTime = until;
+	}
+}
@@ -0,0 +1,65 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedSim.h - discrete-event simulation of the SchedTask dispatcher
+
+SchedSim replaces the dispatcher clock with a virtual clock.  Rather than waiting for millis() to advance,
+it jumps the virtual clock directly to the earliest 'next' of all tasks and runs the normal dispatcher
+(SchedBase::dispatcher()) at that instant.  Days of schedule therefore execute in milliseconds of real time,
+which makes it practical to check behavior across the 49.7 day millis() rollover.
+
+Usage (in a host build or on the board itself):
+
+	SchedSim::begin(0xFFFFFFFFUL - 5000);						// start the virtual clock 5 sec before rollover
+	Task.setNext(NOW);												// setNext() and the dispatcher now use virtual time
+	SchedSim::runFor(60000UL);										// run one minute of schedule
+	SchedSim::end();													// back to millis()
+
+A dispatched function can model its own execution time with SchedSim::consume(ms).  Dispatched functions
+should use SchedBase::getTime() instead of millis() if they need the current time.
+
+runFor() accepts up to 0xFFFFFFFF ms per call; call it repeatedly to simulate longer spans.
+
+The virtual clock is 32 bits like millis(), also where unsigned long is 64 bits (e.g. a Linux or macOS host), so a
+host build rolls over after 49.7 days just as the board does.  Compare times by casting the difference to int32_t,
+as the dispatcher does; (signed long) only works where long is 32 bits.
+
+See Example_12 for a regression suite built on SchedSim.
+
+	Change log
+
+		2026-10-19 initial coding
+		2026-10-19 32 bit virtual clock, so 64 bit host builds roll over too
+*/
+
+#ifndef SchedSim_h
+#define SchedSim_h
+
+#include <SchedBase.h>
+
+class SchedSim {
+	typedef unsigned long (*pClock)();
+
+	public:
+
+		static void begin(unsigned long start = 0);				// install the virtual clock starting at 'start'
+		static void end();												// restore the previous clock source
+		static unsigned long now() {return virtualTime;}		// current virtual time
+		static void runFor(unsigned long ms);						// simulate the next 'ms' milliseconds
+		static void runUntil(unsigned long until);				// simulate up to virtual time 'until' (less than 24 days ahead)
+		static void consume(unsigned long ms) {virtualTime += ms;} // a dispatched function took 'ms' to execute (wraps at 32 bits)
+		static unsigned long getPasses() {return passes;}		// number of dispatcher passes run
+
+	private:
+
+		static uint32_t virtualTime;									// the virtual clock in ms (32 bits on every host)
+		static unsigned long passes;									// dispatcher passes since begin()
+		static pClock savedClock;										// clock source to restore in end()
+		static unsigned long readClock() {return virtualTime;}	// clock source installed by begin()
+};
+
+#endif
@@ -0,0 +1,120 @@
+/*
+	SchedSnapshot.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 walk the tasks with getFirstTask()/getNextTask()
+		2026-10-19 IDs from the list position, so SCHED_COMPACT builds don't walk the list for each one
+		2026-10-19 sign extend 'next' where long is 64 bits; refuse iterations that don't fit in 16 bits
+*/
+
+#include <SchedSnapshot.h>
+
+// layout: 'S' 'T' version count { id(2) flags next(4) period(4) iterations(2) } ... check(2), all little endian
+const uint8_t MAGIC0 = 'S';
+const uint8_t MAGIC1 = 'T';
+const uint8_t VERSION = 1;
+const size_t HEADER = 4;
+const size_t RECORD = 13;
+const size_t TRAILER = 2;
+
+const uint8_t ACTIVE = 0x01;											// flags: 'next' was not NEVER
+const long MAX_ITERATIONS = 0x7FFF;									// iterations are saved in 2 bytes
+
+// put()
+void SchedSnapshot::put(uint8_t*& p, unsigned long value, int bytes) {
+	for (int i=0; i<bytes; i++) {
+		*p++ = value & 0xFF;
+		value >>= 8;
+	}
+}
+// get()
+unsigned long SchedSnapshot::get(const uint8_t*& p, int bytes) {
+	unsigned long value = 0;
+	for (int i=0; i<bytes; i++) {
+		value |= (unsigned long)*p++ << (8 * i);
+	}
+	return value;
+}
+// check()
+uint16_t SchedSnapshot::check(const uint8_t* buf, size_t len) {
+	uint16_t a = 0;
+	uint16_t b = 0;
+	for (size_t i=0; i<len; i++) {
+		a = (a + buf[i]) % 255;
+		b = (b + a) % 255;
+	}
+	return b << 8 | a;
+}
+// size()
+size_t SchedSnapshot::size() {
+	size_t tasks = 0;
+	for (SchedBase* pTask = SchedBase::getFirstTask(); pTask; pTask = pTask->getNextTask()) tasks++;
+	return HEADER + tasks * RECORD + TRAILER;
+}
+// save()
+size_t SchedSnapshot::save(uint8_t* buf, size_t len) {
+	size_t needed = size();
+	size_t tasks = (needed - HEADER - TRAILER) / RECORD;
+	if (len < needed || tasks > 255) return 0;
+	for (SchedBase* pTask = SchedBase::getFirstTask(); pTask; pTask = pTask->getNextTask()) {
+		if (pTask->getIterations() > MAX_ITERATIONS) return 0;	// would not survive the round trip
+	}
+	unsigned long now = SchedBase::getTime();
+	uint8_t* p = buf;
+	*p++ = MAGIC0;
+	*p++ = MAGIC1;
+	*p++ = VERSION;
+	put(p, tasks, 1);
+	int pos = 0;
+	for (SchedBase* pTask = SchedBase::getFirstTask(); pTask; pTask = pTask->getNextTask(), pos++) {
+		bool active = pTask->getNext() != NEVER;
+		put(p, pTask->getTaskID(pos), 2);
+		put(p, active ? ACTIVE : 0, 1);
+		put(p, active ? pTask->getNext() - now : 0, 4);				// relative to now; negative when overdue
+		put(p, pTask->getPeriod(), 4);
+		put(p, pTask->getIterations(), 2);
+	}
+	put(p, check(buf, p - buf), 2);
+	return p - buf;
+}
+// restore()
+int SchedSnapshot::restore(const uint8_t* buf, size_t len, unsigned long away) {
+	if (len < HEADER + TRAILER || buf[0] != MAGIC0 || buf[1] != MAGIC1 || buf[2] != VERSION) return -1;
+	size_t count = buf[3];
+	if (len < HEADER + count * RECORD + TRAILER) return -1;
+	const uint8_t* p = buf + HEADER + count * RECORD;
+	if (get(p, 2) != check(buf, HEADER + count * RECORD)) return -1;
+
+	int restored = 0;
+	p = buf + HEADER;
+	for (size_t r=0; r<count; r++) {
+		int id = get(p, 2);
+		uint8_t flags = get(p, 1);
+		signed long next = (int32_t)get(p, 4);					// due this long after the save (sign extended where long is 64 bits)
+		unsigned long period = get(p, 4);
+		int iterations = (int16_t)get(p, 2);
+
+		int pos = 0;
+		for (SchedBase* pTask = SchedBase::getFirstTask(); pTask; pTask = pTask->getNextTask(), pos++) {
+			if (pTask->getTaskID(pos) != id) continue;
+			pTask->setPeriod(period);
+			pTask->setIterations(iterations);
+			if (!(flags & ACTIVE)) {
+				pTask->setNext(NEVER);
+			}
+			else {
+				if (next < 0) next = 0;									// overdue at the save: due at once
+				next -= away;												// due this long after the restore
+				if (next < 0 && period != ONESHOT) {				// missed some; keep the phase
+					next = ((next % (signed long)period) + period) % period;
+				}
+				pTask->setNext(next > 0 ? next : NOW);
+			}
+			restored++;
+			break;
+		}
+	}
+	return restored;
+}
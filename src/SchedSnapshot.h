@@ -0,0 +1,60 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedSnapshot.h - save and restore the timing state of all tasks
+
+After a watchdog reset or a wake from deep sleep every task starts again from its constructor values: the phase
+between tasks and any remaining iterations are lost, and every task with 'next' NOW runs at once.  SchedSnapshot
+saves the timing of every task to a small buffer that the sketch can keep in EEPROM, RTC memory or (in a host
+build) a file, and puts it back in one call:
+
+	uint8_t buf[64];
+	size_t n = SchedSnapshot::save(buf, sizeof(buf));		// 0 if buf is too small (see size()) or see below
+	... write buf[0..n-1] to EEPROM ...
+
+	... after the reset, in setup() ...
+	... read the bytes back into buf ...
+	SchedSnapshot::restore(buf, n);								// returns the number of tasks restored, -1 if buf is not valid
+
+For each task the snapshot holds its 'next' relative to the time of the save, its period, its iterations and
+whether it is active ('next' not NEVER).  Tasks are matched by getTaskID(), so the sketch must construct the same
+tasks in the same order.  Tasks in the snapshot that no longer exist are ignored; tasks not in it are left alone.
+
+The clock stops while the snapshot is stored: a task due 300 ms after the save is due 300 ms after the restore.
+If the sketch knows how long it was away (e.g. from an RTC), pass that time to restore().  Periodic tasks then
+keep their phase, skipping the dispatches they missed (their iterations are not reduced for those); a ONESHOT
+task that was missed is dispatched straight away.  A task that was already overdue at the save is due at once.
+
+Each task takes 13 bytes plus 6 bytes for the whole snapshot (at most 255 tasks); size() returns the exact figure.
+Iterations are saved in 2 bytes, so where int is 32 bits save() returns 0 if any task has more than 32767 left.
+
+	Change log
+
+		2026-10-19 initial coding
+		2026-10-19 overdue tasks restore correctly where long is 64 bits; save() refuses iterations over 32767
+*/
+
+#ifndef SchedSnapshot_h
+#define SchedSnapshot_h
+
+#include <SchedBase.h>
+
+class SchedSnapshot {
+	public:
+
+		static size_t size();											// bytes needed for a snapshot now
+		static size_t save(uint8_t* buf, size_t len);			// bytes written, 0 if len is too small or iterations don't fit
+		static int restore(const uint8_t* buf, size_t len, unsigned long away = 0); // tasks restored, -1 if not a valid snapshot
+
+	private:
+
+		static void put(uint8_t*& p, unsigned long value, int bytes); // little endian
+		static unsigned long get(const uint8_t*& p, int bytes);
+		static uint16_t check(const uint8_t* buf, size_t len);	// Fletcher-16 checksum
+};
+
+#endif
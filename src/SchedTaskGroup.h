@@ -0,0 +1,125 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedTaskGroup.h - header file for the SchedTaskGroup template class, derived from SchedBase.
+
+A SchedTaskGroup dispatches one function for many parameters that share the same timing.  Where a sketch would
+otherwise define one SchedTaskT<T> per LED (or channel, or sensor) all with the same function and period, one
+SchedTaskGroup holds up to N parameters and, when due, calls the function once with a contiguous array of them.
+That is one task in the dispatcher list instead of N, and the function can process all the members in one loop.
+
+Syntax:
+
+SchedTaskGroup<T, N> GroupName (next, period, {iterations,} function);	// 'iterations' is optional
+	where:
+		T is the type of each member (parameter)
+		N is the most members the group can hold (1 to 255)
+		'next', 'period' and 'iterations' are as for SchedTask
+		'function' is the function to be dispatched, of the form:
+
+	void func(T* members, int count) {for (int i=0; i<count; i++) {... members[i] ...}}
+
+Members are added, usually in setup(), and are enabled when added:
+
+	int index = GroupName.add(parameter);							// -1 if the group is full
+
+A member can be disabled and enabled again without changing the others:
+
+	GroupName.disable(index);
+	GroupName.enable(index);
+
+Disabled members are skipped.  If some members are disabled the function is called once for each run of enabled
+members, so it is always given a contiguous array.  The index of members[0] within the group is
+(members - GroupName.getParms()).
+
+Other member functions:
+
+	GroupName.setParm(index, parameter);							// replace a member
+	T GroupName.getParm(index);
+	T* GroupName.getParms();											// all the members
+	int GroupName.getCount();											// members added
+	bool GroupName.isEnabled(index);
+	GroupName.setFuncG(function);										// change the function
+	pFuncG GroupName.getFuncG();
+
+As with SchedTaskT, setFunc() and getFunc() through a SchedBase* are not supported.
+
+	Change log
+
+		2026-10-19 initial coding
+*/
+
+#ifndef SchedTaskGroup_h
+#define SchedTaskGroup_h
+
+#include <SchedBase.h>
+
+template <typename T, int N>
+class SchedTaskGroup : public SchedBase {
+
+	typedef void (*pFuncG)(T*, int);	// pFuncG is of Type pointer to a function that takes an array of T and a count, returns void
+	typedef void (*pFunc)();			// pFunc is of Type pointer to a function that takes no parms and returns void
+
+	static_assert(N > 0 && N < 256, "SchedTaskGroup size must be 1 to 255");
+
+	public:
+		SchedTaskGroup();																	// default constructor
+		SchedTaskGroup(unsigned long next, unsigned long period, pFuncG fun);	// constructor
+		SchedTaskGroup(unsigned long next, unsigned long period, long iterations, pFuncG fun); // constructor with iterations
+		~SchedTaskGroup();																// destructor
+
+		int add(T parm);																	// add an enabled member, return its index (-1 if full)
+		void setParm(int i, T parm) {parms[i] = parm;}							// replace member i
+		T getParm(int i) {return parms[i];}											// get member i
+		T* getParms() {return parms;}													// all the members
+		int getCount() {return count;}												// number of members added
+		void enable(int i) {enabled[i >> 3] |= 1 << (i & 7);}					// dispatch member i
+		void disable(int i) {enabled[i >> 3] &= ~(1 << (i & 7));}				// skip member i
+		bool isEnabled(int i) {return enabled[i >> 3] & (1 << (i & 7));}		// whether member i is dispatched
+		void setFuncG(pFuncG pF) {func = pF;}										// set new function pointer
+		pFuncG getFuncG() {return func;}												// return the function pointer
+
+	private:
+
+		pFuncG func;																		// function to call with the members
+		uint8_t count;																		// members added
+		uint8_t enabled[(N + 7) / 8];													// one bit per member
+		T parms[N];																			// the members
+
+		void setFunc(pFunc) {;} 														// overrides pure virtual in base so this class not abstract
+		pFunc getFunc() {return nullptr;}											// overrides pure virtual in base so this class not abstract
+
+		virtual void callFunc();														// call the function for each run of enabled members
+		virtual bool checkFunc() {return func != NULL && count > 0;}			// whether there is anything to call
+};
+
+// constructor templates
+template <typename T, int N> SchedTaskGroup<T, N>::SchedTaskGroup () : SchedBase(), func(nullptr), count(0), enabled() {}
+template <typename T, int N> SchedTaskGroup<T, N>::SchedTaskGroup (unsigned long nxt, unsigned long intval, pFuncG pFnc) : SchedBase(nxt, intval), func(pFnc), count(0), enabled() {}
+template <typename T, int N> SchedTaskGroup<T, N>::SchedTaskGroup (unsigned long nxt, unsigned long intval, long iters, pFuncG pFnc) : SchedBase(nxt, intval, iters), func(pFnc), count(0), enabled() {}
+
+template <typename T, int N> SchedTaskGroup<T, N>::~SchedTaskGroup() {;}		// destructor
+
+// add()
+template <typename T, int N> int SchedTaskGroup<T, N>::add(T parm) {
+	if (count >= N) return -1;															// full
+	parms[count] = parm;
+	enable(count);
+	return count++;
+}
+// callFunc()
+template <typename T, int N> void SchedTaskGroup<T, N>::callFunc() {
+	int i = 0;
+	while (i < count) {
+		while (i < count && !isEnabled(i)) i++;										// skip disabled members
+		int first = i;
+		while (i < count && isEnabled(i)) i++;										// a run of enabled members
+		if (i > first) func(&parms[first], i - first);
+	}
+}
+
+#endif
@@ -0,0 +1,153 @@
+/*
+	SchedTelemetry.cpp
+
+	changes:
+
+		2026-10-19 initial coding
+		2026-10-19 suspended flag
+		2026-10-19 IDs from the list position, so SCHED_COMPACT builds don't walk the list for each one
+		2026-10-19 due time taken in 32 bits
+		2026-10-19 NAME_LEN
+*/
+
+#include <SchedTelemetry.h>
+
+Print* SchedTelemetry::out = nullptr;
+SchedBase* SchedTelemetry::task = nullptr;
+int SchedTelemetry::index = 0;
+SchedTelemetry::Stage SchedTelemetry::stage = DONE;
+uint8_t SchedTelemetry::type = 0;
+uint8_t SchedTelemetry::seq = 0;
+int SchedTelemetry::remaining = 0;
+int SchedTelemetry::chunk = 0;
+uint8_t SchedTelemetry::sumA = 0;
+uint8_t SchedTelemetry::sumB = 0;
+uint8_t SchedTelemetry::buf[6 + NAME_LEN];
+uint8_t SchedTelemetry::len = 0;
+uint8_t SchedTelemetry::pos = 0;
+
+const uint8_t ACTIVE = 0x01;											// record flags
+const uint8_t DUE = 0x02;
+const uint8_t CLAMPED = 0x04;
+const uint8_t SUSPENDED = 0x08;
+
+// send()
+bool SchedTelemetry::send(Print& o) {
+	return start(o, STATE);
+}
+// sendNames()
+bool SchedTelemetry::sendNames(Print& o) {
+	return start(o, NAMES);
+}
+// start()
+bool SchedTelemetry::start(Print& o, uint8_t t) {
+	if (out) return false;												// still sending
+	out = &o;
+	type = t;
+	task = SchedBase::getFirstTask();
+	index = 0;
+	remaining = 0;
+	for (SchedBase* pTask = task; pTask; pTask = pTask->getNextTask()) remaining++;
+	stage = HEADER;
+	len = pos = 0;
+	poll();																	// make a start
+	return true;
+}
+// poll()
+void SchedTelemetry::poll() {
+	if (!out) return;
+	int room = chunk > 0 ? chunk : out->availableForWrite();
+	while (room > 0) {
+		if (pos == len && !fill()) {									// this piece is sent; make the next
+			out = nullptr;													// frame finished
+			return;
+		}
+		int n = len - pos;
+		if (n > room) n = room;
+		out->write(buf + pos, n);
+		pos += n;
+		room -= n;
+	}
+}
+// put()
+void SchedTelemetry::put(unsigned long value, int bytes) {
+	for (int i=0; i<bytes; i++) {
+		uint8_t b = value & 0xFF;
+		buf[len++] = b;
+		sumA = (sumA + b) % 255;
+		sumB = (sumB + sumA) % 255;
+		value >>= 8;
+	}
+}
+// fill()
+bool SchedTelemetry::fill() {
+	len = pos = 0;
+	switch (stage) {
+		case HEADER:
+			buf[len++] = SYNC0;											// not in the checksum
+			buf[len++] = SYNC1;
+			sumA = sumB = 0;
+			put(type, 1);
+			put(seq++, 1);
+			put(remaining, 2);
+			stage = remaining ? RECORDS : TRAILER;
+			return true;
+		case RECORDS:
+			record(task);
+			if (task) task = task->getNextTask();
+			index++;
+			if (--remaining == 0) stage = TRAILER;
+			return true;
+		case TRAILER: {
+			uint16_t check = sumB << 8 | sumA;
+			buf[len++] = check & 0xFF;
+			buf[len++] = check >> 8;
+			stage = DONE;
+			return true;
+		}
+		default:
+			return false;
+	}
+}
+// record()
+void SchedTelemetry::record(SchedBase* pTask) {
+	if (!pTask) {															// the list got shorter while sending
+		put(0xFFFF, 2);
+		put(0, type == STATE ? 9 : 1);
+		return;
+	}
+	int id = pTask->getTaskID(index);
+	put(id, 2);
+	if (type == NAMES) {
+		const char* name = pTask->getName();
+		int n = strlen(name);
+		if (n > NAME_LEN) n = NAME_LEN;
+		put(n, 1);
+		for (int i=0; i<n; i++) put(name[i], 1);
+		return;
+	}
+	unsigned long next = pTask->getNext();
+	uint8_t flags = 0;
+	signed long due = 0;
+	if (next != NEVER) {
+		flags |= ACTIVE;
+		due = (int32_t)(next - SchedBase::getTime());
+		if (due <= 0) flags |= DUE;
+		if (due > 32767 || due < -32767) {
+			flags |= CLAMPED;
+			due = due > 0 ? 32767 : -32767;
+		}
+	}
+	unsigned long period = pTask->getPeriod();
+	if (period > 0x7FFFUL) {											// as SCHED_COMPACT stores it
+		period = (period + 500) / 1000;
+		period = 0x8000 | (period > 0x7FFFUL ? 0x7FFF : period);
+	}
+	int iterations = pTask->getIterations();
+	if (pTask->isSuspended()) flags |= SUSPENDED;
+	put(flags, 1);
+	put(due, 2);
+	put(period, 2);
+	put(iterations > 32767 ? 32767 : iterations, 2);
+	put(SchedProfiler::getCount(id), 2);
+}
@@ -0,0 +1,96 @@
+/*
+For a complete series of tutorials see:
+https://www.youtube.com/watch?v=nZHBbSkVUSo&list=PL69rZyCQYu-SrPAZUc2Lj_zsjPLxtI9fv
+
+To make a small (secure) appreciation donation see:
+https://www.paypal.com/cgi-bin/webscr?cmd=_s-xclick&hosted_button_id=A2J54W4JEHZ6C
+
+SchedTelemetry.h - send the state of every task to a host as a compact binary frame
+
+send() starts a frame; the frame then goes out a few bytes at a time from poll(), never more than the Print can
+take without waiting (availableForWrite()), so the dispatcher is not held up.  poll() can be called from loop()
+or by using SchedTelemetry as dispatch hooks, where it runs after every idle pass:
+
+	SchedTelemetry::sendNames(Serial);								// once, if SCHED_NAMES is set
+	...
+	SchedTelemetry::send(Serial);										// e.g. from a task every 100 ms; false if the last frame is still going
+	SchedBase::dispatcher<SchedHookChain<SchedProfiler, SchedTelemetry> >(); // SchedProfiler supplies the dispatch counts
+
+For a Print that does not implement availableForWrite() use setChunk() to send a fixed number of bytes per poll().
+
+Frame (all numbers little endian):
+
+	0xA5 0x5A type seq count(2) record ... check(2)
+
+	type 1, state, 11 bytes per task:
+		id(2) flags(1) next(2) period(2) iterations(2) count(2)
+		flags:		0x01 active ('next' is not NEVER), 0x02 due, 0x04 'next' out of range and clamped,
+					0x08 suspended (the task's SchedGroup is suspended)
+		next:			ms until 'next' (negative when overdue), clamped to +/-32767
+		period:		ms up to 32767, otherwise 0x8000 | seconds
+		iterations:	as getIterations(), -1 if not specified
+		count:		dispatches counted by SchedProfiler (low 16 bits), 0 if not profiled
+	type 2, names: id(2) length(1) characters ...
+
+check is the Fletcher-16 checksum of everything from type to the last record.  100 tasks make a 1108 byte frame,
+10 a second at 115200 baud.  Tasks are sent in list order, the most recently constructed first.  Tasks should
+not be constructed or destroyed while a frame is going out.  extras/sched_telemetry.py decodes the frames.
+
+	Change log
+
+		2026-10-19 initial coding
+		2026-10-19 suspended flag
+		2026-10-19 no list walk per record with SCHED_COMPACT
+		2026-10-19 NAME_MAX renamed NAME_LEN (NAME_MAX is a POSIX limits.h macro)
+*/
+
+#ifndef SchedTelemetry_h
+#define SchedTelemetry_h
+
+#include <SchedBase.h>
+#include <SchedProfiler.h>
+
+class SchedTelemetry {
+	public:
+
+		static bool send(Print& out);									// start a state frame; false if a frame is still being sent
+		static bool sendNames(Print& out);							// start a names frame; false if a frame is still being sent
+		static bool busy() {return out != nullptr;}				// a frame is being sent
+		static void poll();												// send as much of the frame as 'out' can take now
+		static void setChunk(int bytes) {chunk = bytes;}		// bytes per poll(); 0 (default) uses availableForWrite()
+
+		static void preDispatch(SchedBase*) {}						// dispatch hooks: poll() after an idle pass
+		static void postDispatch(SchedBase*) {}
+		static void idle() {poll();}
+
+		static const uint8_t SYNC0 = 0xA5;
+		static const uint8_t SYNC1 = 0x5A;
+		static const uint8_t STATE = 1;								// frame types
+		static const uint8_t NAMES = 2;
+		static const int NAME_LEN = 32;								// longest name sent
+
+	private:
+
+		enum Stage {HEADER, RECORDS, TRAILER, DONE};
+
+		static bool start(Print& o, uint8_t t);
+		static bool fill();												// next piece of the frame into buf; false when it's all sent
+		static void record(SchedBase* task);						// one record into buf
+		static void put(unsigned long value, int bytes);		// little endian into buf, adding to the checksum
+
+		static Print* out;												// where the frame is going, nullptr when idle
+		static SchedBase* task;											// next task to send
+		static int index;													// its position in the list
+		static Stage stage;
+		static uint8_t type;
+		static uint8_t seq;												// frame sequence number
+		static int remaining;											// records still to send
+		static int chunk;
+		static uint8_t sumA;												// Fletcher-16 sums
+		static uint8_t sumB;
+		static uint8_t buf[6 + NAME_LEN];							// piece being sent
+		static uint8_t len;
+		static uint8_t pos;
+};
+
+#endif